@@ -0,0 +1,184 @@
+// Copyright (c) 2021 Ethan Margaillan <contact@ethan.jp>.
+// Licensed under the MIT License - https://raw.githubusercontent.com/Ethan13310/ECS/master/LICENSE
+
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace bench
+{
+	// Measures the time spent in the timed sections of a run
+	class Timer
+	{
+	public:
+		using Clock = std::chrono::steady_clock;
+
+		// Start a timed section
+		void start() noexcept
+		{
+			m_start = Clock::now();
+		}
+
+		// End a timed section
+		void stop() noexcept
+		{
+			m_elapsed += Clock::now() - m_start;
+		}
+
+		// Get the time spent in the timed sections, in nanoseconds
+		double getElapsed() const noexcept
+		{
+			return std::chrono::duration<double, std::nano>(m_elapsed).count();
+		}
+
+	private:
+		Clock::time_point m_start;
+		Clock::duration m_elapsed{ 0 };
+	};
+
+	struct Result
+	{
+		// Name of the benchmark
+		std::string name;
+
+		// Size of the benchmark (Entities, Systems, listeners...)
+		std::size_t size;
+
+		// Number of operations per run
+		std::size_t operations;
+
+		// Number of runs
+		std::size_t runs;
+
+		// Time per operation, in nanoseconds
+		double median;
+		double min;
+		double max;
+	};
+
+	// Run the benchmarks and print their results
+	class Runner
+	{
+	public:
+		// Options:
+		//   --max-entities N   Largest number of Entities (default: 1000000)
+		//   --filter NAME      Only run the benchmarks whose name contains NAME
+		//   --format FORMAT    json (default) or csv
+		//   --output PATH      Write the results into a file instead of stdout
+		Runner(int argc, char **argv)
+		{
+			for (int i{ 1 }; i + 1 < argc; i += 2)
+			{
+				std::string const option{ argv[i] };
+				std::string const value{ argv[i + 1] };
+
+				if (option == "--max-entities")
+				{
+					m_maxEntities = std::stoull(value);
+				}
+				else if (option == "--filter")
+				{
+					m_filter = value;
+				}
+				else if (option == "--format")
+				{
+					m_format = value;
+				}
+				else if (option == "--output")
+				{
+					m_output = value;
+				}
+			}
+		}
+
+		// Get the largest number of Entities to use
+		std::size_t getMaxEntities() const noexcept
+		{
+			return m_maxEntities;
+		}
+
+		// Run a benchmark several times
+		// Func is called with a Timer, and must only time the measured operations
+		template <class Func>
+		void run(std::string const &name, std::size_t size, std::size_t operations, Func &&func)
+		{
+			if (name.find(m_filter) == std::string::npos)
+			{
+				return;
+			}
+
+			std::vector<double> times;
+			double total{ 0 };
+
+			// At least 3 runs, and at least 200 ms
+			while (times.size() < 3 || (total < 2e8 && times.size() < 1000))
+			{
+				Timer timer;
+				func(timer);
+
+				times.push_back(timer.getElapsed() / static_cast<double>(operations));
+				total += timer.getElapsed();
+			}
+
+			std::sort(times.begin(), times.end());
+
+			m_results.push_back(Result{ name, size, operations, times.size(), times[times.size() / 2], times.front(), times.back() });
+
+			std::cerr << name << " [" << size << "]: " << times[times.size() / 2] << " ns/op\n";
+		}
+
+		// Print the results
+		void report() const
+		{
+			std::ofstream file;
+
+			if (!m_output.empty())
+			{
+				file.open(m_output);
+			}
+
+			auto &stream{ m_output.empty() ? std::cout : file };
+
+			if (m_format == "csv")
+			{
+				stream << "name,size,operations,runs,median_ns,min_ns,max_ns\n";
+
+				for (auto const &result : m_results)
+				{
+					stream << result.name << ',' << result.size << ',' << result.operations << ',' << result.runs << ','
+						<< result.median << ',' << result.min << ',' << result.max << '\n';
+				}
+
+				return;
+			}
+
+			stream << "[\n";
+
+			for (std::size_t i{ 0 }; i < m_results.size(); ++i)
+			{
+				auto const &result{ m_results[i] };
+
+				stream << "  { \"name\": \"" << result.name << "\", \"size\": " << result.size
+					<< ", \"operations\": " << result.operations << ", \"runs\": " << result.runs
+					<< ", \"median_ns\": " << result.median << ", \"min_ns\": " << result.min
+					<< ", \"max_ns\": " << result.max << " }" << (i + 1 < m_results.size() ? "," : "") << '\n';
+			}
+
+			stream << "]\n";
+		}
+
+	private:
+		std::vector<Result> m_results;
+
+		std::size_t m_maxEntities{ 1000000 };
+		std::string m_filter;
+		std::string m_format{ "json" };
+		std::string m_output;
+	};
+}
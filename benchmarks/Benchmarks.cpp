@@ -0,0 +1,292 @@
+// Copyright (c) 2021 Ethan Margaillan <contact@ethan.jp>.
+// Licensed under the MIT License - https://raw.githubusercontent.com/Ethan13310/ECS/master/LICENSE
+
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+#include <ECS.hpp>
+
+#include "Benchmark.hpp"
+
+struct Position : public ecs::Component
+{
+	Position(float x = 0.f, float y = 0.f) : x{ x }, y{ y } {}
+
+	float x;
+	float y;
+};
+
+struct Velocity : public ecs::Component
+{
+	Velocity(float x = 0.f, float y = 0.f) : x{ x }, y{ y } {}
+
+	float x;
+	float y;
+};
+
+struct Tag : public ecs::Component
+{};
+
+struct Ping : public ecs::Event
+{
+	int value{ 0 };
+};
+
+class MovementSystem : public ecs::System
+{
+public:
+	MovementSystem()
+	{
+		getFilter().require<Position>();
+		getFilter().require<Velocity>();
+	}
+};
+
+// Distinct System types, to measure the cost of the refresh per System
+template <std::size_t I>
+class RefreshSystem : public ecs::System
+{
+public:
+	RefreshSystem()
+	{
+		getFilter().require<Position>();
+	}
+};
+
+template <std::size_t... I>
+void addRefreshSystems(ecs::World &world, std::index_sequence<I...>)
+{
+	(world.addSystem<RefreshSystem<I>>(), ...);
+}
+
+// Entity counts from 10k up to the given maximum
+std::vector<std::size_t> getSizes(std::size_t max)
+{
+	std::vector<std::size_t> sizes;
+
+	for (std::size_t size{ 10000 }; size <= max; size *= 10)
+	{
+		sizes.push_back(size);
+	}
+
+	return sizes;
+}
+
+void benchEntities(bench::Runner &runner)
+{
+	for (auto const size : getSizes(std::min<std::size_t>(runner.getMaxEntities(), 1000000)))
+	{
+		runner.run("create_entity", size, size, [&](bench::Timer &timer)
+		{
+			ecs::World world;
+
+			timer.start();
+
+			for (std::size_t i{ 0 }; i < size; ++i)
+			{
+				world.createEntity();
+			}
+
+			world.update(0);
+			timer.stop();
+		});
+
+		runner.run("remove_entity", size, size, [&](bench::Timer &timer)
+		{
+			ecs::World world;
+
+			for (std::size_t i{ 0 }; i < size; ++i)
+			{
+				world.createEntity();
+			}
+
+			world.update(0);
+			timer.start();
+
+			for (ecs::Entity::Id id{ 0 }; id < size; ++id)
+			{
+				world.removeEntity(id);
+			}
+
+			world.update(0);
+			timer.stop();
+		});
+	}
+}
+
+void benchComponents(bench::Runner &runner)
+{
+	for (auto const size : getSizes(std::min<std::size_t>(runner.getMaxEntities(), 1000000)))
+	{
+		runner.run("add_component", size, size, [&](bench::Timer &timer)
+		{
+			ecs::World world;
+			std::vector<ecs::Entity> entities;
+
+			for (std::size_t i{ 0 }; i < size; ++i)
+			{
+				entities.push_back(world.createEntity());
+			}
+
+			world.update(0);
+			timer.start();
+
+			for (auto &entity : entities)
+			{
+				entity.addComponent<Position>(1.f, 2.f);
+			}
+
+			timer.stop();
+		});
+
+		runner.run("remove_component", size, size, [&](bench::Timer &timer)
+		{
+			ecs::World world;
+			std::vector<ecs::Entity> entities;
+
+			for (std::size_t i{ 0 }; i < size; ++i)
+			{
+				entities.push_back(world.createEntity());
+				entities.back().addComponent<Position>(1.f, 2.f);
+			}
+
+			world.update(0);
+			timer.start();
+
+			for (auto &entity : entities)
+			{
+				entity.removeComponent<Position>();
+			}
+
+			timer.stop();
+		});
+	}
+}
+
+void benchIteration(bench::Runner &runner)
+{
+	for (auto const size : getSizes(runner.getMaxEntities()))
+	{
+		ecs::World world;
+		auto &system{ world.addSystem<MovementSystem>() };
+
+		for (std::size_t i{ 0 }; i < size; ++i)
+		{
+			auto entity{ world.createEntity() };
+			entity.addComponent<Position>();
+			entity.addComponent<Velocity>(1.f, 1.f);
+		}
+
+		world.update(0);
+
+		runner.run("system_for_each", size, size, [&](bench::Timer &timer)
+		{
+			timer.start();
+
+			system.forEach([](ecs::Entity entity)
+			{
+				auto &position{ entity.getComponent<Position>() };
+				auto const &velocity{ entity.getComponent<Velocity>() };
+
+				position.x += velocity.x;
+				position.y += velocity.y;
+			});
+
+			timer.stop();
+		});
+	}
+}
+
+template <std::size_t Systems>
+void benchRefresh(bench::Runner &runner)
+{
+	constexpr std::size_t size{ 10000 };
+
+	ecs::World world;
+	addRefreshSystems(world, std::make_index_sequence<Systems>{});
+
+	std::vector<ecs::Entity> entities;
+
+	for (std::size_t i{ 0 }; i < size; ++i)
+	{
+		entities.push_back(world.createEntity());
+		entities.back().addComponent<Position>();
+	}
+
+	world.update(0);
+
+	// Each Entity is refreshed once per update
+	runner.run("update_entities_refresh", Systems, size, [&](bench::Timer &timer)
+	{
+		for (auto &entity : entities)
+		{
+			if (entity.hasComponent<Tag>())
+			{
+				entity.removeComponent<Tag>();
+			}
+			else
+			{
+				entity.addComponent<Tag>();
+			}
+		}
+
+		timer.start();
+		world.update(0);
+		timer.stop();
+	});
+}
+
+template <std::size_t Listeners>
+void benchEvents(bench::Runner &runner)
+{
+	constexpr std::size_t emits{ 10000 };
+
+	ecs::EventDispatcher dispatcher;
+	int sum{ 0 };
+
+	for (std::size_t i{ 0 }; i < Listeners; ++i)
+	{
+		dispatcher.connect<Ping>([&sum](Ping const &evt)
+		{
+			sum += evt.value;
+		});
+	}
+
+	runner.run("event_emit", Listeners, emits, [&](bench::Timer &timer)
+	{
+		Ping evt;
+		evt.value = 1;
+
+		timer.start();
+
+		for (std::size_t i{ 0 }; i < emits; ++i)
+		{
+			dispatcher.emit(evt);
+		}
+
+		timer.stop();
+	});
+}
+
+int main(int argc, char **argv)
+{
+	bench::Runner runner{ argc, argv };
+
+	benchEntities(runner);
+	benchComponents(runner);
+	benchIteration(runner);
+
+	benchRefresh<1>(runner);
+	benchRefresh<4>(runner);
+	benchRefresh<16>(runner);
+	benchRefresh<64>(runner);
+
+	benchEvents<1>(runner);
+	benchEvents<16>(runner);
+	benchEvents<256>(runner);
+
+	runner.report();
+
+	return 0;
+}
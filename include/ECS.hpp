@@ -4,12 +4,28 @@
 #pragma once
 
 #include <ECS/Component.hpp>
+#include <ECS/ComponentRegistry.hpp>
 #include <ECS/Entity.hpp>
+#include <ECS/ErrorReport.hpp>
 #include <ECS/Event.hpp>
 #include <ECS/EventDispatcher.hpp>
+#include <ECS/FilterTerms.hpp>
+#include <ECS/FilteredSystem.hpp>
+#include <ECS/FrameStats.hpp>
+#include <ECS/Group.hpp>
+#include <ECS/HashedName.hpp>
 #include <ECS/Log.hpp>
+#include <ECS/MappedStorage.hpp>
+#include <ECS/MemoryStats.hpp>
+#include <ECS/Pipeline.hpp>
+#include <ECS/Profiler.hpp>
+#include <ECS/Query.hpp>
+#include <ECS/Snapshot.hpp>
+#include <ECS/SortMode.hpp>
+#include <ECS/StaticWorld.hpp>
 #include <ECS/System.hpp>
 #include <ECS/World.hpp>
+#include <ECS/WorldState.hpp>
 
 #include <ECS/World.inl>
 #include <ECS/Entity.inl>
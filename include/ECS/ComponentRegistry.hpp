@@ -0,0 +1,58 @@
+// Copyright (c) 2021 Ethan Margaillan <contact@ethan.jp>.
+// Licensed under the MIT License - https://raw.githubusercontent.com/Ethan13310/ECS/master/LICENSE
+
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <unordered_map>
+
+#include <ECS/Detail/ComponentInfo.hpp>
+#include <ECS/Detail/TypeInfo.hpp>
+
+namespace ecs
+{
+	// Associate Component types to IDs which do not depend on the order
+	// in which the types are first used, so they can be stored on disk
+	class ComponentRegistry
+	{
+	public:
+		// Stable Component ID type
+		using StableId = std::uint32_t;
+
+		ComponentRegistry() = default;
+		~ComponentRegistry() = default;
+
+		ComponentRegistry(ComponentRegistry const &) = default;
+		ComponentRegistry(ComponentRegistry &&) = default;
+
+		ComponentRegistry &operator=(ComponentRegistry const &) = default;
+		ComponentRegistry &operator=(ComponentRegistry &&) = default;
+
+		// Register the Component T with the given stable ID
+		template <class T>
+		void registerComponent(StableId id);
+
+		// Check whether the Component T is registered
+		template <class T>
+		bool isRegistered() const;
+
+		// Get the stable ID of a Component type
+		std::optional<StableId> getStableId(detail::TypeId typeId) const;
+
+		// Get the description of the Component registered with the stable ID, or nullptr
+		detail::ComponentInfo const *getInfo(StableId id) const;
+
+	private:
+		// Register a Component description
+		void registerInfo(detail::ComponentInfo const &info, StableId id);
+
+		// Component descriptions, by stable ID
+		std::unordered_map<StableId, detail::ComponentInfo> m_components;
+
+		// Stable IDs, by Component type ID
+		std::unordered_map<detail::TypeId, StableId> m_stableIds;
+	};
+}
+
+#include <ECS/ComponentRegistry.inl>
@@ -0,0 +1,23 @@
+// Copyright (c) 2021 Ethan Margaillan <contact@ethan.jp>.
+// Licensed under the MIT License - https://raw.githubusercontent.com/Ethan13310/ECS/master/LICENSE
+
+#pragma once
+
+#include <type_traits>
+
+#include <ECS/Component.hpp>
+
+template <class T>
+void ecs::ComponentRegistry::registerComponent(StableId id)
+{
+	static_assert(std::is_base_of<Component, T>::value, "T must be a Component.");
+	static_assert(std::is_trivially_copyable<T>::value, "T must be trivially copyable to be stored.");
+
+	registerInfo(detail::ComponentInfo::create<T>(), id);
+}
+
+template <class T>
+bool ecs::ComponentRegistry::isRegistered() const
+{
+	return m_stableIds.find(getComponentTypeId<T>()) != m_stableIds.end();
+}
@@ -4,6 +4,9 @@
 #pragma once
 
 #include <bitset>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
 
 #include <ECS/Component.hpp>
 
@@ -17,15 +20,23 @@ namespace ecs::detail
 		ComponentFilter() noexcept = default;
 		~ComponentFilter() = default;
 
-		ComponentFilter(ComponentFilter const &) noexcept = default;
+		ComponentFilter(ComponentFilter const &) = default;
 		ComponentFilter(ComponentFilter &&) noexcept = default;
 
-		ComponentFilter &operator=(ComponentFilter const &) noexcept = default;
+		ComponentFilter &operator=(ComponentFilter const &) = default;
 		ComponentFilter &operator=(ComponentFilter &&) noexcept = default;
 
 		// Check if an Entity matches the requirements
 		bool check(Mask const &mask) const;
 
+		// Check many masks at once, matches[i] being set to whether masks[i]
+		// matches the requirements
+		// The masks are compared as whole words
+		void checkAll(Mask const *masks, std::size_t count, std::uint8_t *matches) const noexcept;
+
+		// Check whether two filters have the same requirements
+		bool operator==(ComponentFilter const &other) const noexcept;
+
 		// Make a Component required
 		template <class T>
 		void require();
@@ -34,22 +45,50 @@ namespace ecs::detail
 		template <class T>
 		void exclude();
 
+		// Require at least one of the Components Ts
+		// Each call adds a group, all groups must be matched
+		template <class... Ts>
+		void requireAnyOf();
+
+		// Make a Component optional: it is neither required nor excluded,
+		// even by excludeNotRequired()
+		template <class T>
+		void optional();
+
 		// Exclude all Components that are not required
 		void excludeNotRequired() noexcept;
 
 		// Exclude all Components
 		void excludeAll() noexcept;
 
-		// Remove a Component from both lists
+		// Remove a Component from all lists
 		template <class T>
 		void ignore();
 
+		// Get the required Components
+		Mask const &getRequired() const noexcept;
+
+		// Get the excluded Components
+		Mask const &getExcluded() const noexcept;
+
+		// Get the groups of Components of which at least one is required
+		std::vector<Mask> const &getAnyOf() const noexcept;
+
+		// Get the optional Components
+		Mask const &getOptional() const noexcept;
+
 	private:
 		// List of required components
 		Mask m_required;
 
 		// List of excluded components
 		Mask m_excluded;
+
+		// Groups of components of which at least one is required
+		std::vector<Mask> m_anyOf;
+
+		// List of optional components
+		Mask m_optional;
 	};
 }
 
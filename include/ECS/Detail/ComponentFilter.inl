@@ -3,11 +3,14 @@
 
 #pragma once
 
+#include <algorithm>
+
 template <class T>
 void ecs::detail::ComponentFilter::require()
 {
 	m_required.set(getComponentTypeId<T>());
 	m_excluded.reset(getComponentTypeId<T>());
+	m_optional.reset(getComponentTypeId<T>());
 }
 
 template <class T>
@@ -15,6 +18,25 @@ void ecs::detail::ComponentFilter::exclude()
 {
 	m_required.reset(getComponentTypeId<T>());
 	m_excluded.set(getComponentTypeId<T>());
+	m_optional.reset(getComponentTypeId<T>());
+}
+
+template <class... Ts>
+void ecs::detail::ComponentFilter::requireAnyOf()
+{
+	Mask group;
+	(group.set(getComponentTypeId<Ts>()), ...);
+
+	m_excluded &= ~group;
+	m_anyOf.push_back(group);
+}
+
+template <class T>
+void ecs::detail::ComponentFilter::optional()
+{
+	m_required.reset(getComponentTypeId<T>());
+	m_excluded.reset(getComponentTypeId<T>());
+	m_optional.set(getComponentTypeId<T>());
 }
 
 template <class T>
@@ -22,4 +44,15 @@ void ecs::detail::ComponentFilter::ignore()
 {
 	m_required.reset(getComponentTypeId<T>());
 	m_excluded.reset(getComponentTypeId<T>());
+	m_optional.reset(getComponentTypeId<T>());
+
+	for (auto &group : m_anyOf)
+	{
+		group.reset(getComponentTypeId<T>());
+	}
+
+	// An empty group could not be matched anymore
+	m_anyOf.erase(std::remove_if(m_anyOf.begin(), m_anyOf.end(), [](Mask const &group) {
+		return group.none();
+	}), m_anyOf.end());
 }
@@ -5,21 +5,26 @@
 
 #include <array>
 #include <memory>
-#include <optional>
+#include <memory_resource>
 #include <vector>
 
 #include <ECS/Component.hpp>
 #include <ECS/Detail/ComponentFilter.hpp>
-#include <ECS/Detail/Reference.hpp>
+#include <ECS/Detail/ComponentInfo.hpp>
+#include <ECS/Detail/ComponentPool.hpp>
+#include <ECS/Detail/EntityBitset.hpp>
 #include <ECS/Detail/TypeInfo.hpp>
 #include <ECS/Entity.hpp>
+#include <ECS/MemoryStats.hpp>
+#include <ECS/SortMode.hpp>
 
 namespace ecs::detail
 {
 	class ComponentHolder
 	{
 	public:
-		ComponentHolder() = default;
+		// The pools and the masks are allocated from the memory resource
+		explicit ComponentHolder(std::pmr::memory_resource *resource = std::pmr::get_default_resource());
 		~ComponentHolder() = default;
 
 		ComponentHolder(ComponentHolder const &) = delete;
@@ -32,6 +37,10 @@ namespace ecs::detail
 		template <class T>
 		T &addComponent(Entity::Id id, std::unique_ptr<T> &&component);
 
+		// Construct the component T of the Entity in place
+		template <class T, class... Args>
+		T &emplaceComponent(Entity::Id id, Args &&...args);
+
 		// Get the Component T from the Entity
 		template <class T>
 		T &getComponent(Entity::Id id);
@@ -50,26 +59,131 @@ namespace ecs::detail
 		// Get the Component mask for the given Entity
 		ComponentFilter::Mask getComponentsMask(Entity::Id id) const;
 
+		// Get the Component masks of all Entities
+		// The index of this array matches the Entity ID
+		std::pmr::vector<ComponentFilter::Mask> const &getComponentsMasks() const noexcept;
+
+		// Get the set of the Entities which have the given Component type
+		EntityBitset const &getEntities(TypeId typeId) const noexcept;
+
+		// Call Func with the ID of each Entity which matches the filter, in
+		// increasing order
+		// The sets of the required Components are intersected word by word,
+		// skipping the regions of Entities that one of them does not cover,
+		// so the cost depends on the Entities having the required Components
+		// rather than on the total number of Entities
+		// The filter must require at least one Component
+		// Return the number of Entities checked, those of the words examined
+		template <class Func>
+		std::size_t forEachMatching(ComponentFilter const &filter, Func &&func) const;
+
+		// Add a group owning the given Component types, or get the existing one
+		// The Components of the Entities which have all the owned types are
+		// kept at the first slots of their pools, in the same order, so that
+		// they can be iterated in lockstep
+		// A Component type can only be owned by one group, and the owned
+		// Components must be relocatable, as they are moved between slots
+		std::size_t addGroup(ComponentFilter::Mask const &owned);
+
+		// Get the number of Entities of a group
+		std::size_t getGroupSize(std::size_t group);
+
+		// Call Func with the ID of each Entity of a group, and a reference to
+		// each of its Components Ts, in slot order
+		// Ts must be the Component types owned by the group
+		template <class... Ts, class Func>
+		void forEachInGroup(std::size_t group, Func &&func);
+
+		// Sort the Components T, moving them within their pool so that they
+		// are stored in order
+		// Compare is called with two Components T, and returns whether the
+		// first one goes before the second one
+		// If T is owned by a group, the Entities of the group stay first, and
+		// the other pools of the group follow the same order
+		template <class T, class Compare>
+		void sortComponents(Compare &&compare, SortMode mode);
+
+		// Get the pool of the given Component type, or nullptr
+		ComponentPool *getPool(TypeId typeId) noexcept;
+
+		// Get the pool of the given Component type, or nullptr
+		ComponentPool const *getPool(TypeId typeId) const noexcept;
+
+		// Get the pool of the given Component type, creating it if necessary
+		ComponentPool &getOrCreatePool(ComponentInfo const &info);
+
+		// Set the Component mask for the given Entity
+		// Used when Components are written directly into the pools
+		void setComponentsMask(Entity::Id id, ComponentFilter::Mask const &mask);
+
+		// Get the number of Entities the holder can store Components for
+		std::size_t size() const noexcept;
+
+		// Get the memory used by the Component masks, the Entity sets and the groups
+		MemoryUsage getMasksMemoryUsage() const noexcept;
+
 		// Resize the Component array
 		void resize(std::size_t size);
 
+		// Replace all Components with copies of the Components of another holder
+		// The memory already allocated by the pools is reused
+		void copyFrom(ComponentHolder const &other);
+
 		// Clear all Components
 		void clear() noexcept;
 
-	private:
-		template <class T>
-		OptionalReference<std::unique_ptr<Component>> getComponentPtr(Entity::Id id);
+		// Keep the Components of the first size Entities, and release the
+		// memory which is not used anymore
+		// The pools which do not hold any Component are removed
+		void shrinkToFit(std::size_t size);
 
+	private:
 		// The index of this array matches the Component type ID
-		using ComponentArray = std::array<std::unique_ptr<Component>, MAX_COMPONENTS>;
+		using PoolArray = std::array<std::unique_ptr<ComponentPool>, MAX_COMPONENTS>;
 
-		// List of all Components of all Entities
-		// The index of this array matches the Entity ID
-		std::vector<ComponentArray> m_components;
+		// Component types whose pools are kept in the same order
+		// The first size slots of each owned pool hold the Components of the
+		// Entities of the group
+		struct OwningGroup
+		{
+			// Owned Component types
+			ComponentFilter::Mask owned;
+
+			// Number of Entities of the group
+			std::size_t size{ 0 };
+		};
+
+		// Move the Components of the Entity right after the group, if it has
+		// all the owned types and is not part of the group yet
+		void enterGroup(OwningGroup &group, Entity::Id id);
+
+		// Move the Components of the Entity right before the end of the group,
+		// and shrink the group, if the Entity is part of it
+		void leaveGroup(OwningGroup &group, Entity::Id id);
+
+		// Rebuild the groups if the pools have been written directly
+		void refreshGroups();
+
+		// List of all Components of all Entities, sorted by type
+		PoolArray m_pools;
 
 		// List of all masks of all Composents of all Entities
 		// The index of this array matches the Entity ID
-		std::vector<ComponentFilter::Mask> m_componentsMasks;
+		std::pmr::vector<ComponentFilter::Mask> m_componentsMasks;
+
+		// The masks transposed: the Entities which have each Component
+		// The index of this array matches the Component type ID
+		std::pmr::vector<EntityBitset> m_entitySets;
+
+		// Owning groups
+		std::pmr::vector<OwningGroup> m_groups;
+
+		// Group owning each Component type, or ComponentPool::npos
+		// The index of this array matches the Component type ID
+		std::array<std::size_t, MAX_COMPONENTS> m_typeGroups;
+
+		// Have the pools been written without maintaining the groups
+		bool m_groupsDirty{ false };
 	};
 }
 
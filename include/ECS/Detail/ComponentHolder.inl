@@ -3,6 +3,14 @@
 
 #pragma once
 
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <tuple>
+#include <utility>
+
+#include <ECS/Detail/Sort.hpp>
 #include <ECS/Exceptions/Exception.hpp>
 #include <ECS/Exceptions/InvalidComponent.hpp>
 #include <ECS/Exceptions/InvalidEntity.hpp>
@@ -10,7 +18,18 @@
 template <class T>
 T &ecs::detail::ComponentHolder::addComponent(Entity::Id id, std::unique_ptr<T> &&component)
 {
-	if (id >= m_components.size())
+	if (component == nullptr)
+	{
+		throw InvalidComponent{ "ecs::Entity::addComponent()" };
+	}
+
+	return emplaceComponent<T>(id, std::move(*component));
+}
+
+template <class T, class... Args>
+T &ecs::detail::ComponentHolder::emplaceComponent(Entity::Id id, Args &&...args)
+{
+	if (id >= m_componentsMasks.size())
 	{
 		// The Entity ID is out of range
 		throw InvalidEntity{ "ecs::Entity::addComponent()" };
@@ -18,71 +37,270 @@ T &ecs::detail::ComponentHolder::addComponent(Entity::Id id, std::unique_ptr<T>
 
 	auto const typeId{ getComponentTypeId<T>() };
 
-	if (typeId >= m_components[id].size())
+	if (typeId >= m_pools.size())
 	{
 		// The Component type ID is out of range
 		throw InvalidComponent{ "ecs::Entity::addComponent()" };
 	}
 
-	m_components[id][typeId] = std::move(component);
+	// Replacing a Component moves it to another slot
+	auto const group{ m_typeGroups[typeId] };
+
+	if (group != ComponentPool::npos)
+	{
+		refreshGroups();
+		leaveGroup(m_groups[group], id);
+	}
+
+	T *component{ nullptr };
+
+	try
+	{
+		component = &getOrCreatePool(ComponentInfo::create<T>()).template emplace<T>(id, std::forward<Args>(args)...);
+	}
+	catch (...)
+	{
+		// The previous Component, if any, is still there
+		if (group != ComponentPool::npos)
+		{
+			enterGroup(m_groups[group], id);
+		}
+
+		throw;
+	}
+
 	m_componentsMasks[id].set(typeId);
+	m_entitySets[typeId].set(id);
 
-	return *static_cast<T*>(m_components[id][typeId].get());
+	if (group != ComponentPool::npos)
+	{
+		// Joining the group may have moved the Component
+		enterGroup(m_groups[group], id);
+
+		return *static_cast<T*>(m_pools[typeId]->get(id));
+	}
+
+	return *component;
 }
 
 template <class T>
 T &ecs::detail::ComponentHolder::getComponent(Entity::Id id)
 {
-	auto component{ getComponentPtr<T>(id) };
-
-	if (!component.has_value() || component.value().get() == nullptr)
+	if (!hasComponent<T>(id))
 	{
 		// The Component does not exist
 		throw Exception{ "Entity does not have this Component.", "ecs::Entity::getComponent()" };
 	}
 
-	return *static_cast<T*>(component.value()->get());
+	return *static_cast<T*>(m_pools[getComponentTypeId<T>()]->get(id));
 }
 
 template <class T>
 bool ecs::detail::ComponentHolder::hasComponent(Entity::Id id) const
 {
+	auto const typeId{ getComponentTypeId<T>() };
+
 	// Is the Entity ID and the Component type ID known
-	if (id < m_components.size())
+	if (id < m_componentsMasks.size() && typeId < m_pools.size())
+	{
+		return m_componentsMasks[id][typeId];
+	}
+
+	return false;
+}
+
+template <class T>
+void ecs::detail::ComponentHolder::removeComponent(Entity::Id id)
+{
+	if (hasComponent<T>(id))
 	{
+		// The Component exists, we remove it
 		auto const typeId{ getComponentTypeId<T>() };
+		auto const group{ m_typeGroups[typeId] };
 
-		// Is the Component type ID known
-		if (typeId < m_components[id].size())
+		if (group != ComponentPool::npos)
 		{
-			return m_components[id][typeId] != nullptr;
+			refreshGroups();
+			leaveGroup(m_groups[group], id);
 		}
+
+		m_pools[typeId]->remove(id);
+		m_componentsMasks[id].reset(typeId);
+		m_entitySets[typeId].reset(id);
 	}
+}
 
-	return false;
+template <class... Ts, class Func>
+void ecs::detail::ComponentHolder::forEachInGroup(std::size_t group, Func &&func)
+{
+	static_assert(sizeof...(Ts) > 0, "At least one Component must be iterated.");
+
+	refreshGroups();
+
+	auto const size{ m_groups[group].size };
+
+	if (size == 0)
+	{
+		return;
+	}
+
+	std::array<ComponentPool *, sizeof...(Ts)> const pools{ m_pools[getComponentTypeId<Ts>()].get()... };
+
+	for (std::size_t first{ 0 }; first < size;)
+	{
+		// The Components are contiguous up to the next page boundary of any pool
+		auto last{ size };
+
+		for (auto const pool : pools)
+		{
+			auto const pageSlots{ pool->getPageSlots() };
+			last = std::min(last, (first / pageSlots + 1) * pageSlots);
+		}
+
+		auto const components{ std::make_tuple(static_cast<Ts*>(m_pools[getComponentTypeId<Ts>()]->getSlotAddress(first))...) };
+
+		for (auto slot{ first }; slot < last; ++slot)
+		{
+			std::apply([&](auto *...component)
+			{
+				func(pools[0]->getOwner(slot), component[slot - first]...);
+			}, components);
+		}
+
+		first = last;
+	}
 }
 
-template <class T>
-void ecs::detail::ComponentHolder::removeComponent(Entity::Id id)
+template <class T, class Compare>
+void ecs::detail::ComponentHolder::sortComponents(Compare &&compare, SortMode mode)
 {
-	auto component{ getComponentPtr<T>(id) };
+	auto const typeId{ getComponentTypeId<T>() };
+	auto const pool{ getPool(typeId) };
 
-	if (component.has_value())
+	if (pool == nullptr)
 	{
-		// The Component exists, we remove it
-		component.value()->reset();
-		m_componentsMasks[id].reset(getComponentTypeId<T>());
+		return;
+	}
+
+	refreshGroups();
+
+	// Owners of the Components, in storage order
+	std::pmr::vector<Entity::Id> order{ m_componentsMasks.get_allocator().resource() };
+	order.reserve(pool->size());
+
+	pool->forEach([&](Entity::Id id, void const *)
+	{
+		order.push_back(id);
+	});
+
+	auto const before{ [&](Entity::Id lhs, Entity::Id rhs)
+	{
+		return compare(*static_cast<T const*>(pool->get(lhs)), *static_cast<T const*>(pool->get(rhs)));
+	} };
+
+	auto const group{ m_typeGroups[typeId] };
+	auto const groupSize{ group != ComponentPool::npos ? static_cast<std::ptrdiff_t>(m_groups[group].size) : 0 };
+
+	// The Entities of the group are sorted apart, so that they stay first
+	detail::sort(order.begin(), order.begin() + groupSize, before, mode);
+	detail::sort(order.begin() + groupSize, order.end(), before, mode);
+
+	pool->permute(order);
+
+	if (group != ComponentPool::npos)
+	{
+		order.resize(static_cast<std::size_t>(groupSize));
+
+		for (TypeId owned{ 0 }; owned < MAX_COMPONENTS; ++owned)
+		{
+			if (owned != typeId && m_groups[group].owned.test(owned))
+			{
+				m_pools[owned]->permute(order);
+			}
+		}
 	}
 }
 
-template <class T>
-ecs::detail::OptionalReference<std::unique_ptr<ecs::Component>> ecs::detail::ComponentHolder::getComponentPtr(Entity::Id id)
+template <class Func>
+std::size_t ecs::detail::ComponentHolder::forEachMatching(ComponentFilter const &filter, Func &&func) const
 {
-	if (!hasComponent<T>(id))
+	constexpr auto wordBits{ EntityBitset::WORD_BITS };
+
+	// Each word examined checks the Entities it covers at once
+	std::size_t checks{ 0 };
+
+	// Only the Component types that some Entities have are relevant
+	std::array<EntityBitset const *, MAX_COMPONENTS> required{};
+	std::array<EntityBitset const *, MAX_COMPONENTS> excluded{};
+	std::size_t requiredCount{ 0 };
+	std::size_t excludedCount{ 0 };
+	std::size_t summaryCount{ 0 };
+
+	for (TypeId typeId{ 0 }; typeId < MAX_COMPONENTS; ++typeId)
 	{
-		// The Component does not exist
-		return std::nullopt;
+		auto const &set{ m_entitySets[typeId] };
+
+		if (filter.getRequired().test(typeId))
+		{
+			summaryCount = requiredCount == 0 ? set.getSummaryCount() : std::min(summaryCount, set.getSummaryCount());
+			required[requiredCount++] = &set;
+		}
+		else if (filter.getExcluded().test(typeId) && !set.none())
+		{
+			excluded[excludedCount++] = &set;
+		}
+	}
+
+	for (std::size_t region{ 0 }; region < summaryCount; ++region)
+	{
+		auto summary{ required[0]->getSummary(region) };
+
+		for (std::size_t i{ 1 }; i < requiredCount && summary != 0; ++i)
+		{
+			summary &= required[i]->getSummary(region);
+		}
+
+		while (summary != 0)
+		{
+			auto const index{ region * wordBits + countTrailingZeros(summary) };
+			summary &= summary - 1;
+
+			checks += std::min<std::size_t>(wordBits, m_componentsMasks.size() - std::min(m_componentsMasks.size(), index * wordBits));
+
+			auto word{ required[0]->getWord(index) };
+
+			for (std::size_t i{ 1 }; i < requiredCount; ++i)
+			{
+				word &= required[i]->getWord(index);
+			}
+
+			for (std::size_t i{ 0 }; i < excludedCount && word != 0; ++i)
+			{
+				word &= ~excluded[i]->getWord(index);
+			}
+
+			for (auto const &group : filter.getAnyOf())
+			{
+				std::uint64_t any{ 0 };
+
+				for (TypeId typeId{ 0 }; typeId < MAX_COMPONENTS && word != 0; ++typeId)
+				{
+					if (group.test(typeId))
+					{
+						any |= m_entitySets[typeId].getWord(index);
+					}
+				}
+
+				word &= any;
+			}
+
+			while (word != 0)
+			{
+				func(static_cast<Entity::Id>(index * wordBits + countTrailingZeros(word)));
+				word &= word - 1;
+			}
+		}
 	}
 
-	return m_components[id][getComponentTypeId<T>()];
+	return checks;
 }
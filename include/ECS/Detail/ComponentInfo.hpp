@@ -0,0 +1,46 @@
+// Copyright (c) 2021 Ethan Margaillan <contact@ethan.jp>.
+// Licensed under the MIT License - https://raw.githubusercontent.com/Ethan13310/ECS/master/LICENSE
+
+#pragma once
+
+#include <cstddef>
+
+#include <ECS/Detail/TypeInfo.hpp>
+
+namespace ecs::detail
+{
+	// Type-erased description of a Component type, used by the storage
+	// to handle Components without knowing their actual type
+	struct ComponentInfo
+	{
+		// Component type ID
+		TypeId typeId{ 0 };
+
+		// Size of the Component, in bytes
+		std::size_t size{ 0 };
+
+		// Alignment of the Component, in bytes
+		std::size_t alignment{ 0 };
+
+		// Can the Component be copied with std::memcpy
+		bool triviallyCopyable{ false };
+
+		// Destroy the Component stored at the given address
+		void (*destroy)(void *component) noexcept { nullptr };
+
+		// Copy-construct a Component at dst from the Component at src
+		// nullptr if the Component is not copy constructible
+		void (*copy)(void *dst, void const *src) { nullptr };
+
+		// Move-construct a Component at dst from the Component at src, then
+		// destroy the Component at src
+		// nullptr if the Component is not nothrow move constructible
+		void (*relocate)(void *dst, void *src) noexcept { nullptr };
+
+		// Get the description of the Component T
+		template <class T>
+		static ComponentInfo create() noexcept;
+	};
+}
+
+#include <ECS/Detail/ComponentInfo.inl>
@@ -0,0 +1,47 @@
+// Copyright (c) 2021 Ethan Margaillan <contact@ethan.jp>.
+// Licensed under the MIT License - https://raw.githubusercontent.com/Ethan13310/ECS/master/LICENSE
+
+#pragma once
+
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include <ECS/Component.hpp>
+
+template <class T>
+ecs::detail::ComponentInfo ecs::detail::ComponentInfo::create() noexcept
+{
+	static_assert(std::is_base_of<Component, T>::value, "T must be a Component.");
+
+	ComponentInfo info;
+
+	info.typeId = getComponentTypeId<T>();
+	info.size = sizeof(T);
+	info.alignment = alignof(T);
+	info.triviallyCopyable = std::is_trivially_copyable<T>::value;
+
+	info.destroy = [](void *component) noexcept
+	{
+		static_cast<T*>(component)->~T();
+	};
+
+	if constexpr (std::is_copy_constructible<T>::value)
+	{
+		info.copy = [](void *dst, void const *src)
+		{
+			new (dst) T(*static_cast<T const*>(src));
+		};
+	}
+
+	if constexpr (std::is_nothrow_move_constructible<T>::value)
+	{
+		info.relocate = [](void *dst, void *src) noexcept
+		{
+			new (dst) T(std::move(*static_cast<T*>(src)));
+			static_cast<T*>(src)->~T();
+		};
+	}
+
+	return info;
+}
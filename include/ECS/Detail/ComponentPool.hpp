@@ -0,0 +1,204 @@
+// Copyright (c) 2021 Ethan Margaillan <contact@ethan.jp>.
+// Licensed under the MIT License - https://raw.githubusercontent.com/Ethan13310/ECS/master/LICENSE
+
+#pragma once
+
+#include <cstddef>
+#include <limits>
+#include <memory>
+#include <memory_resource>
+#include <vector>
+
+#include <ECS/Detail/ComponentInfo.hpp>
+#include <ECS/Entity.hpp>
+#include <ECS/MemoryStats.hpp>
+
+// Minimum alignment of the storage pages, in bytes
+// Each page starts on this boundary, whatever the alignment of the Component,
+// so that the Components can be processed with aligned SIMD loads
+#ifndef ECS_PAGE_ALIGNMENT
+	#define ECS_PAGE_ALIGNMENT 64
+#endif
+
+namespace ecs::detail
+{
+	// Storage of all the Components of a given type
+	// Components are stored into fixed-size pages, so their address never
+	// changes as long as they are not removed, nor moved by an owning group
+	// or a sort
+	class ComponentPool
+	{
+	public:
+		// Invalid slot or Entity ID
+		static constexpr std::size_t npos{ std::numeric_limits<std::size_t>::max() };
+
+		// Size of a page, in bytes
+		static constexpr std::size_t PAGE_SIZE{ 16384 };
+
+		// Minimum alignment of a page, in bytes
+		static constexpr std::size_t PAGE_ALIGNMENT{ ECS_PAGE_ALIGNMENT };
+
+		static_assert(PAGE_ALIGNMENT > 0 && (PAGE_ALIGNMENT & (PAGE_ALIGNMENT - 1)) == 0, "ECS_PAGE_ALIGNMENT must be a power of two.");
+
+		// The pages and the slot lists are allocated from the memory resource
+		explicit ComponentPool(ComponentInfo const &info, std::pmr::memory_resource *resource = std::pmr::get_default_resource());
+		~ComponentPool();
+
+		ComponentPool(ComponentPool const &) = delete;
+		ComponentPool(ComponentPool &&) = delete;
+
+		ComponentPool &operator=(ComponentPool const &) = delete;
+		ComponentPool &operator=(ComponentPool &&) = delete;
+
+		// Construct the Component of the Entity
+		// The previous Component of the Entity, if any, is destroyed
+		template <class T, class... Args>
+		T &emplace(Entity::Id id, Args &&...args);
+
+		// Get uninitialized storage for the Component of the Entity
+		// The previous Component of the Entity, if any, is destroyed
+		// The caller must construct the Component at the returned address
+		void *assign(Entity::Id id);
+
+		// Check whether the Entity has a Component in this pool
+		bool has(Entity::Id id) const noexcept;
+
+		// Get the Component of the Entity, or nullptr
+		void *get(Entity::Id id) noexcept;
+
+		// Get the Component of the Entity, or nullptr
+		void const *get(Entity::Id id) const noexcept;
+
+		// Destroy the Component of the Entity
+		void remove(Entity::Id id) noexcept;
+
+		// Destroy all Components and release the memory
+		void clear() noexcept;
+
+		// Allocate enough pages to hold count Components
+		void reserve(std::size_t count);
+
+		// Release the trailing free slots and the pages which do not hold any
+		// Component anymore
+		// The Components are not moved, so the free slots between the used
+		// ones are kept
+		void shrinkToFit();
+
+		// Use external memory as the first pages of the pool, which must be empty
+		// The memory holds one Component per slot, for each slot of owners, and
+		// must be large enough to complete the last page
+		// It must be aligned for the Component, but the pages it holds do not
+		// need to be aligned on PAGE_ALIGNMENT
+		// storage keeps the memory alive as long as the pool uses it
+		void adopt(void *data, std::vector<Entity::Id> owners, std::shared_ptr<void> storage);
+
+		// Replace the Components with copies of the Components of another pool
+		// of the same type, keeping the same slots
+		// Trivially copyable Components are copied page by page, and the
+		// pages already allocated are reused
+		void copyFrom(ComponentPool const &other);
+
+		// Move the Component of the Entity into a slot
+		// The Component which was in the slot, if any, is moved into the
+		// previous slot of the Entity
+		// The slot must be one of the slots used so far, and the Component
+		// must be relocatable
+		void moveToSlot(Entity::Id id, std::size_t slot);
+
+		// Move the Components so that the Component of the Entity order[i]
+		// takes the slot i
+		// The Components of the other Entities take the remaining slots
+		// The Entities of order must be unique and have a Component in this
+		// pool, and the Component must be relocatable
+		void permute(std::pmr::vector<Entity::Id> const &order);
+
+		// Get the slot of the Component of the Entity, or npos
+		std::size_t getSlot(Entity::Id id) const noexcept;
+
+		// Get the owner of a slot, or npos if the slot is free
+		Entity::Id getOwner(std::size_t slot) const noexcept;
+
+		// Get the address of a slot
+		void *getSlotAddress(std::size_t slot) noexcept;
+
+		// Get the number of Components stored
+		std::size_t size() const noexcept;
+
+		// Get the description of the stored Component type
+		ComponentInfo const &getInfo() const noexcept;
+
+		// Get the number of Components per page
+		std::size_t getPageSlots() const noexcept;
+
+		// Get the alignment of the pages allocated by the pool
+		std::size_t getPageAlignment() const noexcept;
+
+		// Get the memory used by the pool
+		// The external pages are not counted
+		MemoryUsage getMemoryUsage() const noexcept;
+
+		// Iterate through all Components, in storage order
+		// Func is called with the Entity ID and the Component address
+		template <class Func>
+		void forEach(Func &&func) const;
+
+	private:
+		// Get a free slot for the Entity, allocating a new page if necessary
+		std::size_t acquireSlot(Entity::Id id);
+
+		// Give back a slot which does not hold any Component
+		void releaseSlot(std::size_t slot) noexcept;
+
+		// Move the Component of the Entity into a slot, and the Component
+		// which was in the slot, if any, into the previous slot of the Entity
+		// The free slots are not updated
+		void relocate(Entity::Id id, std::size_t slot);
+
+		// Destroy all Components, but keep the pages
+		void destroyAll() noexcept;
+
+		// Bind a constructed slot to the Entity, destroying its previous Component
+		void bind(Entity::Id id, std::size_t slot) noexcept;
+
+		// Get the address of a slot
+		void *address(std::size_t slot) const noexcept;
+
+		// Description of the stored Component type
+		ComponentInfo m_info;
+
+		// Number of slots per page
+		std::size_t m_pageSlots{ 1 };
+
+		// Alignment of the allocated pages
+		std::size_t m_pageAlignment{ PAGE_ALIGNMENT };
+
+		// Number of Components stored
+		std::size_t m_size{ 0 };
+
+		// Storage pages
+		std::pmr::vector<void*> m_pages;
+
+		// Number of pages, at the beginning of m_pages, which are not owned by the pool
+		std::size_t m_externalPages{ 0 };
+
+		// Owner of the external pages
+		std::shared_ptr<void> m_storage;
+
+		// Slot of each Entity Component
+		// The index of this array matches the Entity ID
+		std::pmr::vector<std::size_t> m_slots;
+
+		// Owner of each slot, or npos if the slot is free
+		// The index of this array matches the slot index
+		std::pmr::vector<Entity::Id> m_owners;
+
+		// List of free slots
+		std::pmr::vector<std::size_t> m_freeSlots;
+
+		// Storage of one Component, used to swap two slots
+		// Allocated the first time two Components are swapped
+		void *m_scratch{ nullptr };
+	};
+}
+
+#include <ECS/Detail/ComponentPool.inl>
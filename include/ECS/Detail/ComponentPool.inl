@@ -0,0 +1,42 @@
+// Copyright (c) 2021 Ethan Margaillan <contact@ethan.jp>.
+// Licensed under the MIT License - https://raw.githubusercontent.com/Ethan13310/ECS/master/LICENSE
+
+#pragma once
+
+#include <new>
+#include <utility>
+
+template <class T, class... Args>
+T &ecs::detail::ComponentPool::emplace(Entity::Id id, Args &&...args)
+{
+	auto const slot{ acquireSlot(id) };
+
+	T *component{ nullptr };
+
+	try
+	{
+		component = new (address(slot)) T(std::forward<Args>(args)...);
+	}
+	catch (...)
+	{
+		// Nothing has been constructed, give the slot back
+		releaseSlot(slot);
+		throw;
+	}
+
+	bind(id, slot);
+
+	return *component;
+}
+
+template <class Func>
+void ecs::detail::ComponentPool::forEach(Func &&func) const
+{
+	for (std::size_t slot{ 0 }; slot < m_owners.size(); ++slot)
+	{
+		if (m_owners[slot] != npos)
+		{
+			func(m_owners[slot], static_cast<void const*>(address(slot)));
+		}
+	}
+}
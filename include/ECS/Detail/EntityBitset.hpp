@@ -0,0 +1,99 @@
+// Copyright (c) 2021 Ethan Margaillan <contact@ethan.jp>.
+// Licensed under the MIT License - https://raw.githubusercontent.com/Ethan13310/ECS/master/LICENSE
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <vector>
+
+#ifdef _MSC_VER
+	#include <intrin.h>
+#endif
+
+#include <ECS/Entity.hpp>
+#include <ECS/MemoryStats.hpp>
+
+namespace ecs::detail
+{
+	// Get the index of the lowest bit set, value must not be 0
+	inline unsigned countTrailingZeros(std::uint64_t value) noexcept
+	{
+	#ifdef _MSC_VER
+		unsigned long index;
+		_BitScanForward64(&index, value);
+
+		return static_cast<unsigned>(index);
+	#else
+		return static_cast<unsigned>(__builtin_ctzll(value));
+	#endif
+	}
+
+	// Set of Entity IDs, one bit per Entity
+	// Each bit of the summary tells whether a word of bits is not empty, so
+	// that a summary word covers a region of 4096 Entities which can be
+	// skipped at once when empty
+	class EntityBitset
+	{
+	public:
+		// The words use the allocator of the container holding the set
+		using allocator_type = std::pmr::polymorphic_allocator<std::uint64_t>;
+
+		// Number of bits in a word
+		static constexpr std::size_t WORD_BITS{ 64 };
+
+		// Number of Entities covered by a summary word
+		static constexpr std::size_t REGION_SIZE{ WORD_BITS * WORD_BITS };
+
+		explicit EntityBitset(allocator_type const &allocator = {});
+		EntityBitset(EntityBitset const &other, allocator_type const &allocator);
+		EntityBitset(EntityBitset &&other, allocator_type const &allocator);
+		~EntityBitset() = default;
+
+		EntityBitset(EntityBitset const &) = default;
+		EntityBitset(EntityBitset &&) = default;
+
+		EntityBitset &operator=(EntityBitset const &) = default;
+		EntityBitset &operator=(EntityBitset &&) = default;
+
+		// Add an Entity to the set
+		void set(Entity::Id id);
+
+		// Remove an Entity from the set
+		void reset(Entity::Id id) noexcept;
+
+		// Check whether an Entity is part of the set
+		bool test(Entity::Id id) const noexcept;
+
+		// Check whether the set is empty
+		bool none() const noexcept;
+
+		// Remove all Entities
+		void clear() noexcept;
+
+		// Forget the Entities from size onwards and release the unused memory
+		void shrinkToFit(std::size_t size);
+
+		// Get the word of bits of the Entities [index * 64, index * 64 + 64),
+		// which is 0 past the end of the set
+		std::uint64_t getWord(std::size_t index) const noexcept;
+
+		// Get the summary word of the words [index * 64, index * 64 + 64),
+		// which is 0 past the end of the set
+		std::uint64_t getSummary(std::size_t index) const noexcept;
+
+		// Get the number of summary words
+		std::size_t getSummaryCount() const noexcept;
+
+		// Get the memory used by the words
+		MemoryUsage getMemoryUsage() const noexcept;
+
+	private:
+		// One bit per Entity
+		std::pmr::vector<std::uint64_t> m_words;
+
+		// One bit per word, set if the word is not empty
+		std::pmr::vector<std::uint64_t> m_summary;
+	};
+}
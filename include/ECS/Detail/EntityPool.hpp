@@ -3,16 +3,19 @@
 
 #pragma once
 
+#include <memory_resource>
 #include <vector>
 
 #include <ECS/Entity.hpp>
+#include <ECS/MemoryStats.hpp>
 
 namespace ecs::detail
 {
 	class EntityPool
 	{
 	public:
-		EntityPool() = default;
+		// The stored IDs are allocated from the memory resource
+		explicit EntityPool(std::pmr::memory_resource *resource = std::pmr::get_default_resource());
 		~EntityPool() = default;
 
 		EntityPool(EntityPool const &) = delete;
@@ -31,9 +34,26 @@ namespace ecs::detail
 		// reset the next Entity ID value
 		void reset() noexcept;
 
+		// Forget the Entity IDs from size onwards, which become the next IDs
+		// to be created, and release the unused memory
+		// None of these IDs must be in use
+		void shrinkToFit(Entity::Id size);
+
+		// Get the list of stored Entity IDs
+		std::pmr::vector<Entity::Id> const &getStoredIds() const noexcept;
+
+		// Get the next Entity ID
+		Entity::Id getNextId() const noexcept;
+
+		// Replace the content of the pool
+		void restore(Entity::Id nextId, std::vector<Entity::Id> const &storedIds);
+
+		// Get the memory used by the stored IDs
+		MemoryUsage getMemoryUsage() const noexcept;
+
 	private:
 		// List of stored Entities IDs
-		std::vector<Entity::Id> m_storedIds;
+		std::pmr::vector<Entity::Id> m_storedIds;
 
 		// Next Entity ID
 		Entity::Id m_nextId{ 0 };
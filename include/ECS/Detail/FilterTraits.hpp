@@ -0,0 +1,100 @@
+// Copyright (c) 2021 Ethan Margaillan <contact@ethan.jp>.
+// Licensed under the MIT License - https://raw.githubusercontent.com/Ethan13310/ECS/master/LICENSE
+
+#pragma once
+
+#include <tuple>
+#include <type_traits>
+
+#include <ECS/Detail/ComponentFilter.hpp>
+#include <ECS/FilterTerms.hpp>
+
+namespace ecs::detail
+{
+	// Describe how a filter term applies to a ComponentFilter
+	// Types lists the Components which are guaranteed to be present, and
+	// MaybeTypes the Components which may be present
+	template <class Term>
+	struct FilterTraits
+	{
+		static constexpr bool isTerm{ false };
+	};
+
+	template <class... Ts>
+	struct FilterTraits<Require<Ts...>>
+	{
+		static constexpr bool isTerm{ true };
+
+		using Types = std::tuple<Ts...>;
+		using MaybeTypes = std::tuple<>;
+
+		static void apply(ComponentFilter &filter)
+		{
+			(filter.require<Ts>(), ...);
+		}
+	};
+
+	template <class... Ts>
+	struct FilterTraits<Exclude<Ts...>>
+	{
+		static constexpr bool isTerm{ true };
+
+		using Types = std::tuple<>;
+		using MaybeTypes = std::tuple<>;
+
+		static void apply(ComponentFilter &filter)
+		{
+			(filter.exclude<Ts>(), ...);
+		}
+	};
+
+	template <class... Ts>
+	struct FilterTraits<AnyOf<Ts...>>
+	{
+		static constexpr bool isTerm{ true };
+
+		using Types = std::tuple<>;
+		using MaybeTypes = std::tuple<Ts...>;
+
+		static void apply(ComponentFilter &filter)
+		{
+			filter.requireAnyOf<Ts...>();
+		}
+	};
+
+	template <class... Ts>
+	struct FilterTraits<Optional<Ts...>>
+	{
+		static constexpr bool isTerm{ true };
+
+		using Types = std::tuple<>;
+		using MaybeTypes = std::tuple<Ts...>;
+
+		static void apply(ComponentFilter &filter)
+		{
+			(filter.optional<Ts>(), ...);
+		}
+	};
+
+	// Components required by all the Terms
+	template <class... Terms>
+	using RequiredTypes = decltype(std::tuple_cat(std::declval<typename FilterTraits<Terms>::Types>()...));
+
+	// Components which may be present, from AnyOf and Optional Terms
+	template <class... Terms>
+	using MaybeTypes = decltype(std::tuple_cat(std::declval<typename FilterTraits<Terms>::MaybeTypes>()...));
+
+	// A Component alone stands for Require<T>
+	template <class T>
+	using AsFilterTerm = std::conditional_t<std::is_base_of<Component, T>::value, Require<T>, T>;
+
+	// Build the filter described by the Terms
+	template <class... Terms>
+	ComponentFilter makeFilter()
+	{
+		ComponentFilter filter;
+		(FilterTraits<Terms>::apply(filter), ...);
+
+		return filter;
+	}
+}
@@ -0,0 +1,73 @@
+// Copyright (c) 2021 Ethan Margaillan <contact@ethan.jp>.
+// Licensed under the MIT License - https://raw.githubusercontent.com/Ethan13310/ECS/master/LICENSE
+
+#pragma once
+
+#include <cstddef>
+#include <memory_resource>
+#include <vector>
+
+#include <ECS/MemoryStats.hpp>
+
+namespace ecs::detail
+{
+	// Linear allocator whose memory is released all at once
+	// The memory is taken from blocks which are kept between two resets, so
+	// allocating does not reach the upstream resource once the blocks have
+	// grown to the size needed by a frame
+	// Deallocating does nothing, the memory is only given back by reset
+	class FrameArena : public std::pmr::memory_resource
+	{
+	public:
+		// Minimum size of a block, in bytes
+		static constexpr std::size_t BLOCK_SIZE{ 65536 };
+
+		// The blocks are allocated from the upstream resource
+		explicit FrameArena(std::pmr::memory_resource *upstream = std::pmr::get_default_resource());
+		~FrameArena() override;
+
+		FrameArena(FrameArena const &) = delete;
+		FrameArena(FrameArena &&) = delete;
+
+		FrameArena &operator=(FrameArena const &) = delete;
+		FrameArena &operator=(FrameArena &&) = delete;
+
+		// Release all the memory allocated since the last reset
+		// If several blocks have been used, they are merged into a single one
+		void reset();
+
+		// Give the blocks back to the upstream resource
+		void release() noexcept;
+
+		// Get the memory allocated since the last reset, and the size of the blocks
+		MemoryUsage getMemoryUsage() const noexcept;
+
+	private:
+		struct Block
+		{
+			void *data;
+			std::size_t size;
+		};
+
+		void *do_allocate(std::size_t bytes, std::size_t alignment) override;
+
+		void do_deallocate(void *p, std::size_t bytes, std::size_t alignment) override;
+
+		bool do_is_equal(std::pmr::memory_resource const &other) const noexcept override;
+
+		// Allocate a new block able to hold bytes with the given alignment
+		void addBlock(std::size_t bytes, std::size_t alignment);
+
+		// Blocks, allocated from the upstream resource
+		std::pmr::vector<Block> m_blocks;
+
+		// Index of the block memory is taken from
+		std::size_t m_current{ 0 };
+
+		// Offset of the free memory within the current block
+		std::size_t m_offset{ 0 };
+
+		// Memory allocated since the last reset
+		std::size_t m_used{ 0 };
+	};
+}
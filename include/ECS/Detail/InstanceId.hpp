@@ -0,0 +1,34 @@
+// Copyright (c) 2021 Ethan Margaillan <contact@ethan.jp>.
+// Licensed under the MIT License - https://raw.githubusercontent.com/Ethan13310/ECS/master/LICENSE
+
+#pragma once
+
+#include <cstdint>
+
+namespace ecs::detail
+{
+	// Identifier of an object, unique within the process
+	// The identifier follows the object when it is moved, and the object it
+	// has been moved from gets a new one
+	class InstanceId
+	{
+	public:
+		InstanceId() noexcept;
+		~InstanceId() = default;
+
+		InstanceId(InstanceId const &) = delete;
+		InstanceId(InstanceId &&other) noexcept;
+
+		InstanceId &operator=(InstanceId const &) = delete;
+		InstanceId &operator=(InstanceId &&other) noexcept;
+
+		// Get the identifier, which is never 0
+		std::uint64_t getValue() const noexcept;
+
+	private:
+		// Get a new identifier
+		static std::uint64_t next() noexcept;
+
+		std::uint64_t m_value;
+	};
+}
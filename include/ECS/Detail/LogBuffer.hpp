@@ -0,0 +1,88 @@
+// Copyright (c) 2021 Ethan Margaillan <contact@ethan.jp>.
+// Licensed under the MIT License - https://raw.githubusercontent.com/Ethan13310/ECS/master/LICENSE
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <string_view>
+
+namespace ecs::detail
+{
+	// Bounded lock-free queue of log messages, written by any number of
+	// threads and read by a single thread
+	// The messages are copied into preallocated records, whose memory is
+	// reused, so pushing a message does not allocate once the records have
+	// grown to the size of the messages
+	class LogBuffer
+	{
+	public:
+		using Clock = std::chrono::system_clock;
+
+		struct Record
+		{
+			// Severity of the message
+			std::size_t level{ 0 };
+
+			// Time the message has been pushed
+			Clock::time_point time;
+
+			// Message
+			std::string message;
+		};
+
+		// The capacity is rounded up to a power of two
+		explicit LogBuffer(std::size_t capacity);
+		~LogBuffer() = default;
+
+		LogBuffer(LogBuffer const &) = delete;
+		LogBuffer(LogBuffer &&) = delete;
+
+		LogBuffer &operator=(LogBuffer const &) = delete;
+		LogBuffer &operator=(LogBuffer &&) = delete;
+
+		// Push a message
+		// Return false if the buffer is full, in which case the message is dropped
+		bool push(std::size_t level, std::string_view message);
+
+		// Pop all the available messages
+		// Func is called with each Record, in order
+		// Must only be called from one thread at a time
+		// Return the number of messages popped
+		template <class Func>
+		std::size_t consume(Func &&func);
+
+		// Check whether there is no message to pop
+		bool empty() const noexcept;
+
+		// Get the maximum number of messages
+		std::size_t capacity() const noexcept;
+
+	private:
+		struct Cell
+		{
+			// Position of the cell in the sequence of pushes and pops
+			std::atomic<std::size_t> sequence;
+
+			// Message held by the cell
+			Record record;
+		};
+
+		// Cells, indexed by position modulo the capacity
+		std::unique_ptr<Cell[]> m_cells;
+
+		// Capacity - 1
+		std::size_t m_mask;
+
+		// Position of the next push
+		alignas(64) std::atomic<std::size_t> m_pushPosition{ 0 };
+
+		// Position of the next pop
+		alignas(64) std::atomic<std::size_t> m_popPosition{ 0 };
+	};
+}
+
+#include <ECS/Detail/LogBuffer.inl>
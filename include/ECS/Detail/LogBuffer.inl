@@ -0,0 +1,34 @@
+// Copyright (c) 2021 Ethan Margaillan <contact@ethan.jp>.
+// Licensed under the MIT License - https://raw.githubusercontent.com/Ethan13310/ECS/master/LICENSE
+
+#pragma once
+
+template <class Func>
+std::size_t ecs::detail::LogBuffer::consume(Func &&func)
+{
+	auto position{ m_popPosition.load(std::memory_order_relaxed) };
+	std::size_t count{ 0 };
+
+	for (;;)
+	{
+		auto &cell{ m_cells[position & m_mask] };
+
+		// The cell has not been written yet
+		if (cell.sequence.load(std::memory_order_acquire) != position + 1)
+		{
+			break;
+		}
+
+		func(static_cast<Record const&>(cell.record));
+
+		// Give the cell back to the producers, one lap later
+		cell.sequence.store(position + m_mask + 1, std::memory_order_release);
+
+		++position;
+		++count;
+	}
+
+	m_popPosition.store(position, std::memory_order_relaxed);
+
+	return count;
+}
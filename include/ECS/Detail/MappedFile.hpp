@@ -0,0 +1,47 @@
+// Copyright (c) 2021 Ethan Margaillan <contact@ethan.jp>.
+// Licensed under the MIT License - https://raw.githubusercontent.com/Ethan13310/ECS/master/LICENSE
+
+#pragma once
+
+#include <cstddef>
+#include <string>
+
+namespace ecs::detail
+{
+	// File mapped into memory
+	// The mapping is private: the mapped memory can be modified, but the
+	// modifications are never written back to the file
+	class MappedFile
+	{
+	public:
+		explicit MappedFile(std::string const &path);
+		~MappedFile();
+
+		MappedFile(MappedFile const &) = delete;
+		MappedFile(MappedFile &&) = delete;
+
+		MappedFile &operator=(MappedFile const &) = delete;
+		MappedFile &operator=(MappedFile &&) = delete;
+
+		// Get the address of the mapped file
+		unsigned char *data() const noexcept;
+
+		// Get the size of the mapped file, in bytes
+		std::size_t size() const noexcept;
+
+	private:
+		// Address of the mapped file
+		unsigned char *m_data{ nullptr };
+
+		// Size of the mapped file
+		std::size_t m_size{ 0 };
+
+		#ifdef _WIN32
+			// File handle
+			void *m_file{ nullptr };
+
+			// File mapping handle
+			void *m_mapping{ nullptr };
+		#endif
+	};
+}
@@ -0,0 +1,44 @@
+// Copyright (c) 2021 Ethan Margaillan <contact@ethan.jp>.
+// Licensed under the MIT License - https://raw.githubusercontent.com/Ethan13310/ECS/master/LICENSE
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include <ECS/MemoryStats.hpp>
+
+namespace ecs::detail
+{
+	// Get the memory used by the elements of a vector, excluding what they own
+	template <class T, class Allocator>
+	MemoryUsage getMemoryUsage(std::vector<T, Allocator> const &vector) noexcept
+	{
+		return MemoryUsage{ vector.size() * sizeof(T), vector.capacity() * sizeof(T) };
+	}
+
+	// Get the memory used by a string
+	template <class Allocator>
+	MemoryUsage getMemoryUsage(std::basic_string<char, std::char_traits<char>, Allocator> const &str) noexcept
+	{
+		// Short strings are stored in the string itself
+		if (str.capacity() < sizeof(str))
+		{
+			return {};
+		}
+
+		return MemoryUsage{ str.size() + 1, str.capacity() + 1 };
+	}
+
+	// Estimate the memory used by an unordered container
+	// Each node holds an element, the next node pointer and the hash
+	template <class Container>
+	MemoryUsage getNodeMemoryUsage(Container const &container) noexcept
+	{
+		constexpr auto nodeSize{ sizeof(typename Container::value_type) + sizeof(void*) + sizeof(std::size_t) };
+
+		auto const used{ container.size() * nodeSize };
+
+		return MemoryUsage{ used, used + container.bucket_count() * sizeof(void*) };
+	}
+}
@@ -0,0 +1,124 @@
+// Copyright (c) 2021 Ethan Margaillan <contact@ethan.jp>.
+// Licensed under the MIT License - https://raw.githubusercontent.com/Ethan13310/ECS/master/LICENSE
+
+#pragma once
+
+#include <cstddef>
+#include <limits>
+#include <memory_resource>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <ECS/Entity.hpp>
+#include <ECS/HashedName.hpp>
+#include <ECS/MemoryStats.hpp>
+
+namespace ecs::detail
+{
+	// Names of the Entities
+	// All the names are stored once, one after the other, into a single
+	// buffer, and are indexed by their hash. Looking a name up never allocates.
+	class NameTable
+	{
+	public:
+		// The names and the index are allocated from the memory resource
+		explicit NameTable(std::pmr::memory_resource *resource = std::pmr::get_default_resource());
+		~NameTable() = default;
+
+		NameTable(NameTable const &) = default;
+		NameTable(NameTable &&) = default;
+
+		NameTable &operator=(NameTable const &) = default;
+		NameTable &operator=(NameTable &&) = default;
+
+		// Name the Entity
+		// Return false if the name is already used, in which case nothing is done
+		// The previous name of the Entity, if any, is removed
+		bool insert(Entity::Id id, std::string_view name);
+
+		// Remove the name of the Entity, if any
+		void erase(Entity::Id id) noexcept;
+
+		// Remove all names, but keep the memory
+		void clear() noexcept;
+
+		// Release the memory which is not needed by the current names
+		void shrinkToFit();
+
+		// Find the Entity with the given name
+		std::optional<Entity::Id> find(std::string_view name) const noexcept;
+
+		// Find the Entity with the given name
+		std::optional<Entity::Id> find(HashedName const &name) const noexcept;
+
+		// Get the name of the Entity
+		// The view remains valid until the table is modified
+		std::optional<std::string_view> getName(Entity::Id id) const noexcept;
+
+		// Get the number of names
+		std::size_t size() const noexcept;
+
+		// Get the memory used by the table
+		MemoryUsage getMemoryUsage() const noexcept;
+
+		// Iterate through all names
+		// Func is called with the Entity ID and its name
+		template <class Func>
+		void forEach(Func &&func) const;
+
+	private:
+		// Empty index bucket
+		static constexpr std::size_t EMPTY{ std::numeric_limits<std::size_t>::max() };
+
+		// Bucket of a removed name, skipped by lookups but reused by insertions
+		static constexpr std::size_t REMOVED{ EMPTY - 1 };
+
+		struct Entry
+		{
+			// Position of the name in the buffer, or EMPTY if the Entity has no name
+			std::size_t offset{ EMPTY };
+
+			// Length of the name
+			std::size_t length{ 0 };
+
+			// Hash of the name
+			HashedName::Hash hash{ 0 };
+		};
+
+		// Get the bucket which holds the Entity, or EMPTY
+		std::size_t findBucket(std::string_view name, HashedName::Hash hash) const noexcept;
+
+		// Get the name of an entry
+		std::string_view view(Entry const &entry) const noexcept;
+
+		// Rebuild the index with the given number of buckets
+		void rehash(std::size_t bucketCount);
+
+		// Remove the unused parts of the buffer
+		void compact();
+
+		// Name of each Entity
+		// The index of this array matches the Entity ID
+		std::pmr::vector<Entry> m_entries;
+
+		// Open-addressing index, holding Entity IDs
+		// Its size is always a power of two
+		std::pmr::vector<Entity::Id> m_buckets;
+
+		// Names, one after the other
+		std::pmr::string m_buffer;
+
+		// Number of names
+		std::size_t m_size{ 0 };
+
+		// Number of buckets which are REMOVED
+		std::size_t m_removed{ 0 };
+
+		// Size of the names which have been removed from the buffer
+		std::size_t m_wasted{ 0 };
+	};
+}
+
+#include <ECS/Detail/NameTable.inl>
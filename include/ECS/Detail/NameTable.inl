@@ -0,0 +1,16 @@
+// Copyright (c) 2021 Ethan Margaillan <contact@ethan.jp>.
+// Licensed under the MIT License - https://raw.githubusercontent.com/Ethan13310/ECS/master/LICENSE
+
+#pragma once
+
+template <class Func>
+void ecs::detail::NameTable::forEach(Func &&func) const
+{
+	for (Entity::Id id{ 0 }; id < m_entries.size(); ++id)
+	{
+		if (m_entries[id].offset != EMPTY)
+		{
+			func(id, view(m_entries[id]));
+		}
+	}
+}
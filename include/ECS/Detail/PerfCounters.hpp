@@ -0,0 +1,72 @@
+// Copyright (c) 2021 Ethan Margaillan <contact@ethan.jp>.
+// Licensed under the MIT License - https://raw.githubusercontent.com/Ethan13310/ECS/master/LICENSE
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+
+namespace ecs::detail
+{
+	// Hardware performance counters of the calling thread
+	// Only available on Linux, through perf_event_open. The counters may also
+	// be unavailable because of the permissions (perf_event_paranoid), the
+	// virtual machine or the CPU, in which case open() fails.
+	class PerfCounters
+	{
+	public:
+		enum Event : std::size_t
+		{
+			Cycles,
+			Instructions,
+			CacheMisses,
+			BranchMisses,
+			EVENT_COUNT
+		};
+
+		using Values = std::array<std::uint64_t, EVENT_COUNT>;
+
+		PerfCounters() = default;
+		~PerfCounters();
+
+		PerfCounters(PerfCounters const &) = delete;
+		PerfCounters(PerfCounters &&other) noexcept;
+
+		PerfCounters &operator=(PerfCounters const &) = delete;
+		PerfCounters &operator=(PerfCounters &&other) noexcept;
+
+		// Open and start the counters of the calling thread
+		// Return false if no counter is available
+		bool open();
+
+		// Close the counters
+		void close() noexcept;
+
+		// Check whether at least one counter is open
+		bool isOpen() const noexcept;
+
+		// Check whether a counter is open
+		bool isAvailable(Event event) const noexcept;
+
+		// Read the counters
+		// The counters which are not available are 0
+		// Return nothing if the counters are closed or cannot be read
+		std::optional<Values> read() const noexcept;
+
+	private:
+		// Counter of each event, or -1
+		// The first open counter leads the group, all the counters are read at once
+		std::array<int, EVENT_COUNT> m_fds{ -1, -1, -1, -1 };
+
+		// Group leader, or -1
+		int m_leader{ -1 };
+
+		// Position of each event in the group
+		std::array<std::size_t, EVENT_COUNT> m_positions{};
+
+		// Number of counters in the group
+		std::size_t m_count{ 0 };
+	};
+}
@@ -0,0 +1,51 @@
+// Copyright (c) 2021 Ethan Margaillan <contact@ethan.jp>.
+// Licensed under the MIT License - https://raw.githubusercontent.com/Ethan13310/ECS/master/LICENSE
+
+#pragma once
+
+#include <algorithm>
+#include <iterator>
+#include <utility>
+
+#include <ECS/SortMode.hpp>
+
+namespace ecs::detail
+{
+	// Sort a range with the given mode, keeping the order of equivalent elements
+	template <class Iterator, class Compare>
+	void sort(Iterator first, Iterator last, Compare &&compare, SortMode mode)
+	{
+		if (mode == SortMode::Full)
+		{
+			std::stable_sort(first, last, compare);
+			return;
+		}
+
+		if (first == last)
+		{
+			return;
+		}
+
+		// Each element is moved back past the greater ones only, so the
+		// elements already in place cost a single comparison
+		for (auto current{ std::next(first) }; current != last; ++current)
+		{
+			if (!compare(*current, *std::prev(current)))
+			{
+				continue;
+			}
+
+			auto value{ std::move(*current) };
+			auto hole{ current };
+
+			do
+			{
+				*hole = std::move(*std::prev(hole));
+				--hole;
+			}
+			while (hole != first && compare(value, *std::prev(hole)));
+
+			*hole = std::move(value);
+		}
+	}
+}
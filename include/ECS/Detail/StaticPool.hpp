@@ -0,0 +1,70 @@
+// Copyright (c) 2021 Ethan Margaillan <contact@ethan.jp>.
+// Licensed under the MIT License - https://raw.githubusercontent.com/Ethan13310/ECS/master/LICENSE
+
+#pragma once
+
+#include <cstddef>
+#include <limits>
+#include <vector>
+
+#include <ECS/Entity.hpp>
+
+namespace ecs::detail
+{
+	// Storage of the Components T of a StaticWorld
+	// The Components are packed into a single array, so that iterating
+	// through them is a plain loop over contiguous memory
+	// Removing a Component moves the last Component into its place
+	template <class T>
+	class StaticPool
+	{
+	public:
+		// Invalid index
+		static constexpr std::size_t npos{ std::numeric_limits<std::size_t>::max() };
+
+		// Construct the Component of the Entity
+		// The previous Component of the Entity, if any, is replaced
+		template <class... Args>
+		T &emplace(Entity::Id id, Args &&...args);
+
+		// Check whether the Entity has a Component in this pool
+		bool has(Entity::Id id) const noexcept;
+
+		// Get the Component of the Entity, which must exist
+		T &get(Entity::Id id) noexcept;
+
+		// Get the Component of the Entity, which must exist
+		T const &get(Entity::Id id) const noexcept;
+
+		// Destroy the Component of the Entity, if any
+		void remove(Entity::Id id);
+
+		// Destroy all Components
+		void clear() noexcept;
+
+		// Get the number of Components
+		std::size_t size() const noexcept;
+
+		// Get the packed Components
+		T *data() noexcept;
+
+		// Get the packed Components
+		T const *data() const noexcept;
+
+		// Get the owner of each packed Component
+		std::vector<Entity::Id> const &getEntities() const noexcept;
+
+	private:
+		// Packed Components
+		std::vector<T> m_components;
+
+		// Owner of each packed Component
+		std::vector<Entity::Id> m_entities;
+
+		// Index of each Entity Component, or npos
+		// The index of this array matches the Entity ID
+		std::vector<std::size_t> m_indices;
+	};
+}
+
+#include <ECS/Detail/StaticPool.inl>
@@ -0,0 +1,104 @@
+// Copyright (c) 2021 Ethan Margaillan <contact@ethan.jp>.
+// Licensed under the MIT License - https://raw.githubusercontent.com/Ethan13310/ECS/master/LICENSE
+
+#pragma once
+
+#include <utility>
+
+template <class T>
+template <class... Args>
+T &ecs::detail::StaticPool<T>::emplace(Entity::Id id, Args &&...args)
+{
+	if (has(id))
+	{
+		auto &component{ m_components[m_indices[id]] };
+		component = T(std::forward<Args>(args)...);
+
+		return component;
+	}
+
+	if (id >= m_indices.size())
+	{
+		m_indices.resize(id + 1, npos);
+	}
+
+	m_components.emplace_back(std::forward<Args>(args)...);
+	m_entities.push_back(id);
+	m_indices[id] = m_components.size() - 1;
+
+	return m_components.back();
+}
+
+template <class T>
+bool ecs::detail::StaticPool<T>::has(Entity::Id id) const noexcept
+{
+	return id < m_indices.size() && m_indices[id] != npos;
+}
+
+template <class T>
+T &ecs::detail::StaticPool<T>::get(Entity::Id id) noexcept
+{
+	return m_components[m_indices[id]];
+}
+
+template <class T>
+T const &ecs::detail::StaticPool<T>::get(Entity::Id id) const noexcept
+{
+	return m_components[m_indices[id]];
+}
+
+template <class T>
+void ecs::detail::StaticPool<T>::remove(Entity::Id id)
+{
+	if (!has(id))
+	{
+		return;
+	}
+
+	auto const index{ m_indices[id] };
+	auto const last{ m_components.size() - 1 };
+
+	// The last Component takes the place of the removed one
+	if (index != last)
+	{
+		m_components[index] = std::move(m_components[last]);
+		m_entities[index] = m_entities[last];
+		m_indices[m_entities[index]] = index;
+	}
+
+	m_components.pop_back();
+	m_entities.pop_back();
+	m_indices[id] = npos;
+}
+
+template <class T>
+void ecs::detail::StaticPool<T>::clear() noexcept
+{
+	m_components.clear();
+	m_entities.clear();
+	m_indices.clear();
+}
+
+template <class T>
+std::size_t ecs::detail::StaticPool<T>::size() const noexcept
+{
+	return m_components.size();
+}
+
+template <class T>
+T *ecs::detail::StaticPool<T>::data() noexcept
+{
+	return m_components.data();
+}
+
+template <class T>
+T const *ecs::detail::StaticPool<T>::data() const noexcept
+{
+	return m_components.data();
+}
+
+template <class T>
+std::vector<ecs::Entity::Id> const &ecs::detail::StaticPool<T>::getEntities() const noexcept
+{
+	return m_entities;
+}
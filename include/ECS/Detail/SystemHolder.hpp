@@ -6,10 +6,13 @@
 #include <functional>
 #include <memory>
 #include <map>
+#include <memory_resource>
+#include <string>
 #include <unordered_map>
 
 #include <ECS/Detail/Reference.hpp>
 #include <ECS/Detail/TypeInfo.hpp>
+#include <ECS/ErrorReport.hpp>
 #include <ECS/System.hpp>
 
 namespace ecs::detail
@@ -17,7 +20,9 @@ namespace ecs::detail
 	class SystemHolder
 	{
 	public:
-		SystemHolder() = default;
+		// The errors thrown by the Systems are reported to the error report
+		// The lists of Systems are allocated from the memory resource
+		explicit SystemHolder(ErrorReport &errorReport, std::pmr::memory_resource *resource = std::pmr::get_default_resource());
 		~SystemHolder();
 
 		SystemHolder(SystemHolder const &) = delete;
@@ -42,6 +47,12 @@ namespace ecs::detail
 		template <class T>
 		bool hasSystem() const;
 
+		// Check whether a System exists
+		bool hasSystem(detail::TypeId id) const;
+
+		// Get the readable name of the type of a System, or an empty string
+		std::string getSystemName(detail::TypeId id) const;
+
 		// Remove a System
 		template <class T>
 		void removeSystem();
@@ -53,15 +64,25 @@ namespace ecs::detail
 		template <class Func>
 		void forEach(Func &&func);
 
+		// Iterate through all valid Systems
+		template <class Func>
+		void forEach(Func &&func) const;
+
 	private:
 		// Remove System from the priority list
 		void removeSystemPriority(detail::TypeId id);
 
+		// Report of the errors thrown by the Systems
+		Reference<ErrorReport> m_errorReport;
+
 		// List of all Systems
-		std::unordered_map<detail::TypeId, std::unique_ptr<System>> m_systems;
+		std::pmr::unordered_map<detail::TypeId, std::unique_ptr<System>> m_systems;
+
+		// std::type_info name of each System type
+		std::pmr::unordered_map<detail::TypeId, char const *> m_typeNames;
 
 		// List of systems priorities
-		std::multimap<std::size_t, detail::TypeId, std::greater<std::size_t>> m_priorities;
+		std::pmr::multimap<std::size_t, detail::TypeId, std::greater<std::size_t>> m_priorities;
 	};
 }
 
@@ -5,9 +5,10 @@
 
 #include <algorithm>
 #include <stdexcept>
+#include <typeinfo>
 
+#include <ECS/ErrorReport.hpp>
 #include <ECS/Exceptions/Exception.hpp>
-#include <ECS/Log.hpp>
 
 template <class T>
 void ecs::detail::SystemHolder::addSystem(std::size_t priority, std::unique_ptr<T> &&system)
@@ -22,6 +23,7 @@ void ecs::detail::SystemHolder::addSystem(std::size_t priority, std::unique_ptr<
 
 	// Then, add the System
 	m_systems[typeId] = std::move(system);
+	m_typeNames[typeId] = typeid(T).name();
 }
 
 template <class T>
@@ -76,6 +78,7 @@ void ecs::detail::SystemHolder::removeSystem()
 
 	// Then, remove the System
 	m_systems.erase(typeId);
+	m_typeNames.erase(typeId);
 }
 
 template <class Func>
@@ -93,7 +96,28 @@ void ecs::detail::SystemHolder::forEach(Func &&func)
 			}
 			catch (std::exception const &e)
 			{
-				Log::error(e.what());
+				m_errorReport->report("ecs::detail::SystemHolder::forEach()", e.what());
+			}
+		}
+	}
+}
+
+template <class Func>
+void ecs::detail::SystemHolder::forEach(Func &&func) const
+{
+	for (auto const &typeId : m_priorities)
+	{
+		auto const system{ m_systems.find(typeId.second) };
+
+		if (system != m_systems.end() && system->second != nullptr)
+		{
+			try
+			{
+				func(static_cast<System const &>(*system->second), typeId.second);
+			}
+			catch (std::exception const &e)
+			{
+				m_errorReport->report("ecs::detail::SystemHolder::forEach()", e.what());
 			}
 		}
 	}
@@ -0,0 +1,49 @@
+// Copyright (c) 2021 Ethan Margaillan <contact@ethan.jp>.
+// Licensed under the MIT License - https://raw.githubusercontent.com/Ethan13310/ECS/master/LICENSE
+
+#pragma once
+
+#include <cstddef>
+#include <limits>
+#include <type_traits>
+
+namespace ecs::detail
+{
+	// Index of T within Ts, or the maximum value if T is not part of Ts
+	template <class T, class... Ts>
+	constexpr std::size_t indexOf() noexcept
+	{
+		constexpr bool matches[]{ std::is_same<T, Ts>::value..., false };
+
+		for (std::size_t index{ 0 }; index < sizeof...(Ts); ++index)
+		{
+			if (matches[index])
+			{
+				return index;
+			}
+		}
+
+		return std::numeric_limits<std::size_t>::max();
+	}
+
+	// Check whether T is part of Ts
+	template <class T, class... Ts>
+	constexpr bool contains() noexcept
+	{
+		return (std::is_same<T, Ts>::value || ...);
+	}
+
+	// Number of times T appears within Ts
+	template <class T, class... Ts>
+	constexpr std::size_t countOf() noexcept
+	{
+		return (std::size_t{ 0 } + ... + (std::is_same<T, Ts>::value ? 1 : 0));
+	}
+
+	// Check whether each type of Ts appears only once
+	template <class... Ts>
+	constexpr bool isUnique() noexcept
+	{
+		return ((countOf<Ts, Ts...>() == 1) && ...);
+	}
+}
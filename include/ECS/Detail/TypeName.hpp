@@ -0,0 +1,12 @@
+// Copyright (c) 2021 Ethan Margaillan <contact@ethan.jp>.
+// Licensed under the MIT License - https://raw.githubusercontent.com/Ethan13310/ECS/master/LICENSE
+
+#pragma once
+
+#include <string>
+
+namespace ecs::detail
+{
+	// Get a readable name from a std::type_info name
+	std::string demangle(char const *typeName);
+}
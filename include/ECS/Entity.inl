@@ -3,7 +3,6 @@
 
 #pragma once
 
-#include <memory>
 #include <utility>
 
 #include <ECS/Entity.hpp>
@@ -12,15 +11,29 @@
 template <class T, class... Args>
 T &ecs::Entity::addComponent(Args &&...args)
 {
+	auto const hadComponent{ hasComponent<T>() };
+
 	m_world.value()->refreshEntity(m_id);
 
-	return m_world.value()->m_components.addComponent<T>(m_id, std::make_unique<T>(std::forward<Args>(args)...));
+	auto &component{ m_world.value()->m_components.emplaceComponent<T>(m_id, std::forward<Args>(args)...) };
+
+	if (!hadComponent)
+	{
+		++m_world.value()->m_frameStats.componentsAdded[getComponentTypeId<T>()];
+	}
+
+	return component;
 }
 
 template <class T>
 T &ecs::Entity::getComponent()
 {
-	return m_world.value()->m_components.getComponent<T>(m_id);
+	auto &component{ m_world.value()->m_components.getComponent<T>(m_id) };
+
+	// The Component may be modified through the returned reference
+	m_world.value()->markChanged(m_id);
+
+	return component;
 }
 
 template <class T>
@@ -38,7 +51,14 @@ bool ecs::Entity::hasComponent() const
 template <class T>
 void ecs::Entity::removeComponent()
 {
+	auto const hadComponent{ hasComponent<T>() };
+
 	m_world.value()->refreshEntity(m_id);
 
 	m_world.value()->m_components.removeComponent<T>(m_id);
+
+	if (hadComponent)
+	{
+		++m_world.value()->m_frameStats.componentsRemoved[getComponentTypeId<T>()];
+	}
 }
@@ -0,0 +1,140 @@
+// Copyright (c) 2021 Ethan Margaillan <contact@ethan.jp>.
+// Licensed under the MIT License - https://raw.githubusercontent.com/Ethan13310/ECS/master/LICENSE
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace ecs
+{
+	// Aggregation of the errors caught by a World and its Systems
+	//
+	// The first occurrence of an error is logged right away. The identical
+	// errors (same site, same message) which follow are only counted, and a
+	// single line with their count is logged at the end of each window.
+	// An error which does not occur during a whole window is logged right
+	// away again the next time.
+	// The window is counted in frames, a frame ending with each call to
+	// World::update(). Each World has its own report.
+	// At most getCapacity() distinct errors are counted: the error reported
+	// the longest time ago is forgotten to make room for a new one, after its
+	// repeated occurrences not logged yet have been.
+	class ErrorReport
+	{
+	public:
+		struct Counter
+		{
+			// Where the error has been caught
+			std::string site;
+
+			// Error message
+			std::string message;
+
+			// Number of occurrences since the counters have been reset
+			std::size_t count{ 0 };
+		};
+
+		// Default maximum number of distinct errors
+		static constexpr std::size_t DEFAULT_CAPACITY{ 256 };
+
+		ErrorReport() = default;
+		~ErrorReport() = default;
+
+		ErrorReport(ErrorReport const &) = delete;
+		ErrorReport(ErrorReport &&) = delete;
+
+		ErrorReport &operator=(ErrorReport const &) = delete;
+		ErrorReport &operator=(ErrorReport &&) = delete;
+
+		// Report an error
+		void report(std::string_view site, std::string_view message);
+
+		// End the current frame, logging the repeated errors at the end of a window
+		void endFrame();
+
+		// Set the number of frames of a window
+		void setWindow(std::size_t frames);
+
+		// Set the maximum number of distinct errors, at least 1
+		void setCapacity(std::size_t capacity);
+
+		// Get the maximum number of distinct errors
+		std::size_t getCapacity() const;
+
+		// Get the number of occurrences of an error
+		std::size_t getCount(std::string_view site, std::string_view message) const;
+
+		// Get the counters of all the errors reported
+		std::vector<Counter> getCounters() const;
+
+		// Reset all the counters
+		void reset();
+
+	private:
+		struct Entry
+		{
+			// Counters of the error
+			Counter counter;
+
+			// Hash of the site and the message
+			std::uint64_t hash{ 0 };
+
+			// Number of errors reported before the last occurrence
+			std::uint64_t lastReport{ 0 };
+
+			// Number of occurrences during the current window, not logged yet
+			std::size_t repeated{ 0 };
+
+			// Has the error occurred during the previous or the current window
+			bool active{ false };
+		};
+
+		// Hash an error
+		static std::uint64_t hash(std::string_view site, std::string_view message) noexcept;
+
+		// Find an error, or return npos
+		std::size_t find(std::uint64_t hash, std::string_view site, std::string_view message) const noexcept;
+
+		// Forget the errors reported the longest time ago, down to count errors
+		// The repeated occurrences not logged yet are added to lines
+		void evict(std::size_t count, std::vector<std::string> &lines);
+
+		// Remove an error from the index
+		void eraseIndex(std::uint64_t hash, std::size_t index) noexcept;
+
+		// Get the repeated errors to log and start a new window
+		std::vector<std::string> endWindow();
+
+		// Get the line logging the repeated occurrences of an error
+		static std::string summarize(Entry const &entry);
+
+		static constexpr std::size_t npos{ static_cast<std::size_t>(-1) };
+
+		// Reported errors
+		std::vector<Entry> m_entries;
+
+		// Index of the reported errors, by hash
+		std::unordered_multimap<std::uint64_t, std::size_t> m_index;
+
+		// Maximum number of distinct errors
+		std::size_t m_capacity{ DEFAULT_CAPACITY };
+
+		// Number of frames of a window
+		std::size_t m_window{ 60 };
+
+		// Number of frames since the beginning of the window
+		std::size_t m_frames{ 0 };
+
+		// Number of errors reported since the report has been created
+		std::uint64_t m_reports{ 0 };
+
+		// Errors can be reported from several threads
+		mutable std::mutex m_mutex;
+	};
+}
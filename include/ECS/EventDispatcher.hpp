@@ -3,18 +3,23 @@
 
 #pragma once
 
+#include <cstddef>
 #include <functional>
+#include <memory_resource>
 #include <unordered_map>
+#include <vector>
 
 #include <ECS/Detail/TypeInfo.hpp>
 #include <ECS/Event.hpp>
+#include <ECS/MemoryStats.hpp>
 
 namespace ecs
 {
 	class EventDispatcher
 	{
 	public:
-		EventDispatcher() = default;
+		// The listeners are allocated from the memory resource
+		explicit EventDispatcher(std::pmr::memory_resource *resource = std::pmr::get_default_resource());
 		~EventDispatcher() = default;
 
 		EventDispatcher(EventDispatcher const &) = delete;
@@ -41,6 +46,19 @@ namespace ecs
 		// Clear all Events
 		void clearAll();
 
+		// Release the memory which is not used by the listeners
+		void shrinkToFit();
+
+		// Get the memory used by the listeners
+		// The memory allocated by the listeners themselves is not counted
+		MemoryUsage getMemoryUsage() const noexcept;
+
+		// Get the number of Events emitted since the last reset, by Event type ID
+		std::pmr::vector<std::size_t> const &getEmitCounts() const noexcept;
+
+		// Reset the number of Events emitted
+		void resetEmitCounts() noexcept;
+
 	private:
 		using EventReceiver = std::function<void(void const *)>;
 
@@ -51,7 +69,10 @@ namespace ecs
 		};
 
 		// Lister list
-		std::unordered_multimap<detail::TypeId, EventReceiverAttributes> m_listeners;
+		std::pmr::unordered_multimap<detail::TypeId, EventReceiverAttributes> m_listeners;
+
+		// Number of Events emitted, by Event type ID
+		mutable std::pmr::vector<std::size_t> m_emitCounts;
 
 		// Next Event handler ID
 		Event::Id m_nextId{ 0 };
@@ -11,7 +11,16 @@ void ecs::EventDispatcher::emit(T const &evt) const
 {
 	static_assert(std::is_base_of<Event, T>::value, "T must be an Event.");
 
-	auto const range{ m_listeners.equal_range(getEventTypeId<T>()) };
+	auto const typeId{ getEventTypeId<T>() };
+
+	if (typeId >= m_emitCounts.size())
+	{
+		m_emitCounts.resize(typeId + 1, 0);
+	}
+
+	++m_emitCounts[typeId];
+
+	auto const range{ m_listeners.equal_range(typeId) };
 
 	for (auto it{ range.first }; it != range.second; ++it)
 	{
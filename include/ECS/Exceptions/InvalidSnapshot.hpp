@@ -0,0 +1,16 @@
+// Copyright (c) 2021 Ethan Margaillan <contact@ethan.jp>.
+// Licensed under the MIT License - https://raw.githubusercontent.com/Ethan13310/ECS/master/LICENSE
+
+#pragma once
+
+#include <ECS/Exceptions/Exception.hpp>
+
+namespace ecs
+{
+	class InvalidSnapshot : public Exception
+	{
+	public:
+		InvalidSnapshot(std::string const &function);
+		~InvalidSnapshot() = default;
+	};
+}
@@ -0,0 +1,41 @@
+// Copyright (c) 2021 Ethan Margaillan <contact@ethan.jp>.
+// Licensed under the MIT License - https://raw.githubusercontent.com/Ethan13310/ECS/master/LICENSE
+
+#pragma once
+
+#include <type_traits>
+
+#include <ECS/Component.hpp>
+
+namespace ecs
+{
+	// Filter term: the Entities must have all the Components Ts
+	template <class... Ts>
+	struct Require
+	{
+		static_assert((std::is_base_of<Component, Ts>::value && ...), "Ts must be Components.");
+	};
+
+	// Filter term: the Entities must have none of the Components Ts
+	template <class... Ts>
+	struct Exclude
+	{
+		static_assert((std::is_base_of<Component, Ts>::value && ...), "Ts must be Components.");
+	};
+
+	// Filter term: the Entities must have at least one of the Components Ts
+	template <class... Ts>
+	struct AnyOf
+	{
+		static_assert(sizeof...(Ts) > 0, "AnyOf must list at least one Component.");
+		static_assert((std::is_base_of<Component, Ts>::value && ...), "Ts must be Components.");
+	};
+
+	// Filter term: the Entities may have the Components Ts, which does not
+	// affect whether they match
+	template <class... Ts>
+	struct Optional
+	{
+		static_assert((std::is_base_of<Component, Ts>::value && ...), "Ts must be Components.");
+	};
+}
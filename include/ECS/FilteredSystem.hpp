@@ -0,0 +1,60 @@
+// Copyright (c) 2021 Ethan Margaillan <contact@ethan.jp>.
+// Licensed under the MIT License - https://raw.githubusercontent.com/Ethan13310/ECS/master/LICENSE
+
+#pragma once
+
+#include <tuple>
+
+#include <ECS/Detail/ComponentFilter.hpp>
+#include <ECS/Detail/FilterTraits.hpp>
+#include <ECS/FilterTerms.hpp>
+#include <ECS/System.hpp>
+
+namespace ecs
+{
+	// System whose filter is declared by its Terms (Require, Exclude, AnyOf and Optional)
+	// instead of being built within its constructor
+	// The Terms can be read from the type alone, without instantiating the System
+	template <class... Terms>
+	class FilteredSystem : public System
+	{
+	public:
+		static_assert((detail::FilterTraits<Terms>::isTerm && ...), "Terms must be Require, Exclude, AnyOf or Optional.");
+
+		// Components that every attached Entity has
+		using RequiredComponents = detail::RequiredTypes<Terms...>;
+
+		// Components that the attached Entities may have (AnyOf and Optional)
+		using MaybeComponents = detail::MaybeTypes<Terms...>;
+
+		~FilteredSystem() override = default;
+
+		FilteredSystem(FilteredSystem const &) = delete;
+		FilteredSystem(FilteredSystem &&) = default;
+
+		FilteredSystem &operator=(FilteredSystem const &) = delete;
+		FilteredSystem &operator=(FilteredSystem &&) = default;
+
+		// Get the filter described by the Terms
+		// It is built once for all the Systems of this type
+		static detail::ComponentFilter const &getStaticFilter();
+
+		// Iterate through all enabled Entities
+		// Func is either called with the Entity, or with the Entity,
+		// a reference to each of the RequiredComponents then a pointer to
+		// each of the MaybeComponents, null if the Entity does not have it
+		template <class Func>
+		void forEach(Func &&func);
+
+	protected:
+		// This class must be inherited
+		FilteredSystem();
+
+	private:
+		// Call Func with the Entity, its Components Ts and its Components Us if any
+		template <class Func, class... Ts, class... Us>
+		void forEachComponents(Func &func, std::tuple<Ts...> const *, std::tuple<Us...> const *);
+	};
+}
+
+#include <ECS/FilteredSystem.inl>
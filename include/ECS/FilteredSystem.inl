@@ -0,0 +1,46 @@
+// Copyright (c) 2021 Ethan Margaillan <contact@ethan.jp>.
+// Licensed under the MIT License - https://raw.githubusercontent.com/Ethan13310/ECS/master/LICENSE
+
+#pragma once
+
+#include <type_traits>
+#include <utility>
+
+template <class... Terms>
+ecs::FilteredSystem<Terms...>::FilteredSystem()
+{
+	getFilter() = getStaticFilter();
+}
+
+template <class... Terms>
+ecs::detail::ComponentFilter const &ecs::FilteredSystem<Terms...>::getStaticFilter()
+{
+	static detail::ComponentFilter const filter{ detail::makeFilter<Terms...>() };
+
+	return filter;
+}
+
+template <class... Terms>
+template <class Func>
+void ecs::FilteredSystem<Terms...>::forEach(Func &&func)
+{
+	if constexpr (std::is_invocable<Func &, Entity const &>::value)
+	{
+		System::forEach(std::forward<Func>(func));
+	}
+	else
+	{
+		forEachComponents(func, static_cast<RequiredComponents const *>(nullptr), static_cast<MaybeComponents const *>(nullptr));
+	}
+}
+
+template <class... Terms>
+template <class Func, class... Ts, class... Us>
+void ecs::FilteredSystem<Terms...>::forEachComponents(Func &func, std::tuple<Ts...> const *, std::tuple<Us...> const *)
+{
+	System::forEach([&func](Entity const &attached) {
+		Entity entity{ attached };
+		func(entity, entity.template getComponent<Ts>()...,
+			(entity.template hasComponent<Us>() ? &entity.template getComponent<Us>() : nullptr)...);
+	});
+}
@@ -0,0 +1,99 @@
+// Copyright (c) 2021 Ethan Margaillan <contact@ethan.jp>.
+// Licensed under the MIT License - https://raw.githubusercontent.com/Ethan13310/ECS/master/LICENSE
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <vector>
+
+#include <ECS/Component.hpp>
+#include <ECS/Event.hpp>
+
+namespace ecs
+{
+	// Structural changes performed by a World during one frame
+	// The frame includes everything done since the end of the previous update
+	struct FrameStats
+	{
+		// Number of Entities created
+		std::size_t entitiesCreated{ 0 };
+
+		// Number of Entities removed
+		std::size_t entitiesRemoved{ 0 };
+
+		// Number of Entities enabled, including the created ones
+		// Enabling an enabled Entity is not counted
+		std::size_t entitiesEnabled{ 0 };
+
+		// Number of Entities disabled
+		// Disabling a disabled Entity is not counted
+		std::size_t entitiesDisabled{ 0 };
+
+		// Number of Components added, by Component type ID
+		// Replacing a Component is not counted
+		std::array<std::size_t, MAX_COMPONENTS> componentsAdded{};
+
+		// Number of Components removed, by Component type ID
+		// The Components of the removed Entities are included, removing a
+		// missing Component is not counted
+		std::array<std::size_t, MAX_COMPONENTS> componentsRemoved{};
+
+		// Number of Entity actions processed by updateEntities
+		std::size_t actionsProcessed{ 0 };
+
+		// Number of Entity filter checks performed against the Systems
+		// When a System starts, the Entities whose Component bits have been
+		// examined are counted, even if they are checked 64 at a time
+		std::size_t filterChecks{ 0 };
+
+		// Number of Entities attached to a System
+		std::size_t attachCallbacks{ 0 };
+
+		// Number of Entities detached from a System
+		std::size_t detachCallbacks{ 0 };
+
+		// Number of Events emitted, by Event type ID
+		std::vector<std::size_t> eventsEmitted;
+
+		// Get the number of Components T added
+		template <class T>
+		std::size_t getComponentsAdded() const noexcept
+		{
+			return componentsAdded[getComponentTypeId<T>()];
+		}
+
+		// Get the number of Components T removed
+		template <class T>
+		std::size_t getComponentsRemoved() const noexcept
+		{
+			return componentsRemoved[getComponentTypeId<T>()];
+		}
+
+		// Get the number of Events T emitted
+		template <class T>
+		std::size_t getEventsEmitted() const noexcept
+		{
+			auto const id{ getEventTypeId<T>() };
+
+			return id < eventsEmitted.size() ? eventsEmitted[id] : 0;
+		}
+
+		// Reset all counters, keeping the allocated memory
+		void reset() noexcept
+		{
+			entitiesCreated = 0;
+			entitiesRemoved = 0;
+			entitiesEnabled = 0;
+			entitiesDisabled = 0;
+			componentsAdded.fill(0);
+			componentsRemoved.fill(0);
+			actionsProcessed = 0;
+			filterChecks = 0;
+			attachCallbacks = 0;
+			detachCallbacks = 0;
+			std::fill(eventsEmitted.begin(), eventsEmitted.end(), 0);
+		}
+	};
+}
@@ -0,0 +1,70 @@
+// Copyright (c) 2021 Ethan Margaillan <contact@ethan.jp>.
+// Licensed under the MIT License - https://raw.githubusercontent.com/Ethan13310/ECS/master/LICENSE
+
+#pragma once
+
+#include <cstddef>
+#include <type_traits>
+
+#include <ECS/Component.hpp>
+#include <ECS/Detail/ComponentFilter.hpp>
+#include <ECS/Detail/TypeList.hpp>
+#include <ECS/Entity.hpp>
+
+namespace ecs
+{
+	class World;
+
+	// Owning group of the Components Ts
+	// The World keeps the Components Ts of the Entities which have all of them
+	// at the beginning of their pools, in the same order, so that the group
+	// iterates through them in lockstep, with linear memory accesses
+	// The group is declared on construction and kept by the World until it is
+	// destroyed, the other Groups of the same Components share it
+	// A Component type can only be owned by one group, and the owned Components
+	// are moved as Entities join and leave the group, so their address does not
+	// stay the same
+	template <class... Ts>
+	class Group
+	{
+	public:
+		static_assert(sizeof...(Ts) > 0, "A Group must own at least one Component.");
+		static_assert((std::is_base_of<Component, Ts>::value && ...), "Ts must be Components.");
+		static_assert(detail::isUnique<Ts...>(), "Ts must be unique.");
+		static_assert((std::is_nothrow_move_constructible<Ts>::value && ...), "Owned Components must be nothrow move constructible.");
+
+		explicit Group(World &world);
+		~Group() = default;
+
+		Group(Group const &) = default;
+		Group(Group &&) = default;
+
+		Group &operator=(Group const &) = default;
+		Group &operator=(Group &&) = default;
+
+		// Get the number of Entities which have all the Components Ts
+		std::size_t getEntityCount();
+
+		// Iterate through the Entities which have all the Components Ts,
+		// including the disabled ones
+		// Func is called with the Entity and a reference to each Component
+		// As with Entity::getComponent(), each Entity iterated is recorded as
+		// modified for the delta snapshots
+		// The Entities and the Components Ts must not be added or removed
+		// during the iteration
+		template <class Func>
+		void forEach(Func &&func);
+
+	private:
+		// Get the mask of the Components Ts
+		static detail::ComponentFilter::Mask getOwnedMask();
+
+		// World holding the Components
+		World *m_world;
+
+		// Index of the group within the World
+		std::size_t m_index;
+	};
+}
+
+#include <ECS/Group.inl>
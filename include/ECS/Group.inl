@@ -0,0 +1,43 @@
+// Copyright (c) 2021 Ethan Margaillan <contact@ethan.jp>.
+// Licensed under the MIT License - https://raw.githubusercontent.com/Ethan13310/ECS/master/LICENSE
+
+#pragma once
+
+#include <ECS/World.hpp>
+
+template <class... Ts>
+ecs::Group<Ts...>::Group(World &world) :
+	m_world{ &world },
+	m_index{ world.m_components.addGroup(getOwnedMask()) }
+{}
+
+template <class... Ts>
+std::size_t ecs::Group<Ts...>::getEntityCount()
+{
+	return m_world->m_components.getGroupSize(m_index);
+}
+
+template <class... Ts>
+template <class Func>
+void ecs::Group<Ts...>::forEach(Func &&func)
+{
+	auto &world{ *m_world };
+
+	world.m_components.template forEachInGroup<Ts...>(m_index, [&](Entity::Id id, Ts &...components)
+	{
+		world.markChanged(id);
+
+		auto entity{ world.m_entities[id].entity };
+		func(entity, components...);
+	});
+}
+
+template <class... Ts>
+ecs::detail::ComponentFilter::Mask ecs::Group<Ts...>::getOwnedMask()
+{
+	detail::ComponentFilter::Mask owned;
+
+	(owned.set(getComponentTypeId<Ts>()), ...);
+
+	return owned;
+}
@@ -0,0 +1,46 @@
+// Copyright (c) 2021 Ethan Margaillan <contact@ethan.jp>.
+// Licensed under the MIT License - https://raw.githubusercontent.com/Ethan13310/ECS/master/LICENSE
+
+#pragma once
+
+#include <cstdint>
+#include <string_view>
+
+namespace ecs
+{
+	// Entity name along with its hash
+	// Declare frequently used names as constants so that they are hashed at
+	// compile time, then look them up with World::getEntity()
+	class HashedName
+	{
+	public:
+		using Hash = std::uint64_t;
+
+		constexpr explicit HashedName(std::string_view name) noexcept;
+		~HashedName() = default;
+
+		constexpr HashedName(HashedName const &) = default;
+		constexpr HashedName(HashedName &&) = default;
+
+		constexpr HashedName &operator=(HashedName const &) = default;
+		constexpr HashedName &operator=(HashedName &&) = default;
+
+		// Get the name
+		constexpr std::string_view getName() const noexcept;
+
+		// Get the hash of the name
+		constexpr Hash getHash() const noexcept;
+
+		// Hash a name (64-bit FNV-1a)
+		static constexpr Hash hash(std::string_view name) noexcept;
+
+	private:
+		// Name, which is not owned
+		std::string_view m_name;
+
+		// Hash of the name
+		Hash m_hash;
+	};
+}
+
+#include <ECS/HashedName.inl>
@@ -0,0 +1,32 @@
+// Copyright (c) 2021 Ethan Margaillan <contact@ethan.jp>.
+// Licensed under the MIT License - https://raw.githubusercontent.com/Ethan13310/ECS/master/LICENSE
+
+#pragma once
+
+constexpr ecs::HashedName::HashedName(std::string_view name) noexcept :
+	m_name{ name },
+	m_hash{ hash(name) }
+{}
+
+constexpr std::string_view ecs::HashedName::getName() const noexcept
+{
+	return m_name;
+}
+
+constexpr ecs::HashedName::Hash ecs::HashedName::getHash() const noexcept
+{
+	return m_hash;
+}
+
+constexpr ecs::HashedName::Hash ecs::HashedName::hash(std::string_view name) noexcept
+{
+	Hash value{ 14695981039346656037ull };
+
+	for (auto const c : name)
+	{
+		value ^= static_cast<unsigned char>(c);
+		value *= 1099511628211ull;
+	}
+
+	return value;
+}
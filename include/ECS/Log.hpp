@@ -3,27 +3,64 @@
 
 #pragma once
 
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <memory>
 #include <optional>
 #include <string>
+#include <string_view>
+
+// Minimum level of the messages which are logged
+// Calls to the lower levels are removed at compile time
+// 0: info, 1: success, 2: warning, 3: error, 4: none
+#ifndef ECS_LOG_LEVEL
+	#define ECS_LOG_LEVEL 0
+#endif
 
 namespace ecs
 {
 	class Log
 	{
 	public:
+		enum class Level
+		{
+			Info,
+			Success,
+			Warning,
+			Error,
+			None
+		};
+
+		// Minimum level of the messages which are logged
+		static constexpr Level MIN_LEVEL{ static_cast<Level>(ECS_LOG_LEVEL) };
+
 		Log() = delete;
 
 		// Print info message
-		static void info(std::string const &message);
+		static void info(std::string_view message);
 
 		// Print success message
-		static void success(std::string const &message);
+		static void success(std::string_view message);
 
 		// Print warning message
-		static void warning(std::string const &message);
+		static void warning(std::string_view message);
 
 		// Print error message
-		static void error(std::string const &message);
+		static void error(std::string_view message);
+
+		// Enable or disable asynchronous logging
+		// Messages are queued into a ring buffer of the given capacity and
+		// printed by a background thread. Messages pushed while the buffer is
+		// full are dropped and counted.
+		// Must not be called while other threads are logging
+		static void enableAsync(bool enable = true, std::size_t capacity = 4096);
+
+		// Check whether asynchronous logging is enabled
+		static bool asyncEnabled() noexcept;
+
+		// Wait until all the queued messages have been printed
+		static void flush();
 
 		// Enable or disable colors
 		static void enableColors(bool enable = true);
@@ -68,26 +105,29 @@ namespace ecs
 			Underline
 		};
 
-		// Log a message
-		static void log(std::string const& header, Color headerColor, std::string const& message);
+		using Clock = std::chrono::system_clock;
+
+		// Background thread printing the queued messages
+		class AsyncWriter;
 
-		// Print message header to stdout
-		static void printHeader(std::string const& str, Color color);
+		// Log a message, either right away or through the background thread
+		static void log(Level level, std::string_view message);
 
-		// Print text to stdout followed by a new line
-		static void printLine(std::string const& str);
+		// Print a message to stdout, without flushing it
+		// line is used as a scratch buffer
+		static void write(Level level, Clock::time_point time, std::string_view message, std::string &line);
 
-		// Print text to stdout
-		static void print(std::string const& str);
+		// Append message header
+		static void printHeader(std::string &line, std::string_view str, Color color);
 
-		// Change console text style
-		static void format(Style style);
+		// Append text style
+		static void format(std::string &line, Style style);
 
-		// Change console text color
-		static void format(Color color);
+		// Append text color
+		static void format(std::string &line, Color color);
 
-		// Get current date
-		static std::string getDate();
+		// Get the date of a given time
+		static std::string getDate(Clock::time_point time);
 
 		// Are the colors enabled
 		static inline bool m_enableColors{ true };
@@ -97,5 +137,13 @@ namespace ecs
 
 		// Is the console configured
 		static inline ColorsInitializer m_colors{};
+
+		// Background thread, when asynchronous logging is enabled
+		static std::unique_ptr<AsyncWriter> m_asyncWriter;
+
+		// Background thread, read by the logging threads
+		static std::atomic<AsyncWriter*> m_writer;
 	};
 }
+
+#include <ECS/Log.inl>
@@ -0,0 +1,36 @@
+// Copyright (c) 2021 Ethan Margaillan <contact@ethan.jp>.
+// Licensed under the MIT License - https://raw.githubusercontent.com/Ethan13310/ECS/master/LICENSE
+
+#pragma once
+
+inline void ecs::Log::info(std::string_view message)
+{
+	if constexpr (Level::Info >= MIN_LEVEL)
+	{
+		log(Level::Info, message);
+	}
+}
+
+inline void ecs::Log::success(std::string_view message)
+{
+	if constexpr (Level::Success >= MIN_LEVEL)
+	{
+		log(Level::Success, message);
+	}
+}
+
+inline void ecs::Log::warning(std::string_view message)
+{
+	if constexpr (Level::Warning >= MIN_LEVEL)
+	{
+		log(Level::Warning, message);
+	}
+}
+
+inline void ecs::Log::error(std::string_view message)
+{
+	if constexpr (Level::Error >= MIN_LEVEL)
+	{
+		log(Level::Error, message);
+	}
+}
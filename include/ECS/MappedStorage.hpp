@@ -0,0 +1,51 @@
+// Copyright (c) 2021 Ethan Margaillan <contact@ethan.jp>.
+// Licensed under the MIT License - https://raw.githubusercontent.com/Ethan13310/ECS/master/LICENSE
+
+#pragma once
+
+#include <string>
+
+#include <ECS/ComponentRegistry.hpp>
+#include <ECS/Detail/Reference.hpp>
+
+namespace ecs
+{
+	class World;
+
+	// Store a World into a file which is mapped into memory when opened
+	//
+	// The Components of the registered types are stored in the file with the
+	// same layout as in memory, so opening the file does not copy them: the
+	// Component storage of the World points into the mapped file, and the
+	// Components are only read from the disk when they are first accessed.
+	// The mapping is private, the modifications made to the World are never
+	// written back to the file. Use save() to write them.
+	// Values are stored with the byte order of the host.
+	class MappedStorage
+	{
+	public:
+		explicit MappedStorage(ComponentRegistry const &registry);
+		~MappedStorage() = default;
+
+		MappedStorage(MappedStorage const &) = default;
+		MappedStorage(MappedStorage &&) = default;
+
+		MappedStorage &operator=(MappedStorage const &) = default;
+		MappedStorage &operator=(MappedStorage &&) = default;
+
+		// Write the World into the file
+		// Entity actions which have not been processed yet are not saved
+		void save(World const &world, std::string const &path) const;
+
+		// Map the file and use it as the storage of the World
+		// All the Entities of the World are removed, then the Entities of the
+		// file are restored with their original IDs. The Entities are attached
+		// to the Systems during the next update of the World.
+		// The World is left untouched if the file is invalid
+		void open(World &world, std::string const &path) const;
+
+	private:
+		// Registered Components
+		detail::Reference<ComponentRegistry const> m_registry;
+	};
+}
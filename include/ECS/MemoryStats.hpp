@@ -0,0 +1,120 @@
+// Copyright (c) 2021 Ethan Margaillan <contact@ethan.jp>.
+// Licensed under the MIT License - https://raw.githubusercontent.com/Ethan13310/ECS/master/LICENSE
+
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include <ECS/Detail/TypeInfo.hpp>
+
+namespace ecs
+{
+	// Memory used by a container, in bytes
+	struct MemoryUsage
+	{
+		// Memory holding elements
+		std::size_t used{ 0 };
+
+		// Memory allocated, including the unused capacity
+		std::size_t reserved{ 0 };
+
+		MemoryUsage &operator+=(MemoryUsage const &other) noexcept
+		{
+			used += other.used;
+			reserved += other.reserved;
+
+			return *this;
+		}
+	};
+
+	// Memory used by a World
+	// The memory of the hash tables is estimated from their number of
+	// elements and buckets, as their nodes are allocated by the standard library
+	struct MemoryStats
+	{
+		struct Component
+		{
+			// Component type ID
+			detail::TypeId typeId{ 0 };
+
+			// Number of Components stored
+			std::size_t count{ 0 };
+
+			// Memory of the Component pool
+			MemoryUsage memory;
+		};
+
+		struct System
+		{
+			// System type ID
+			detail::TypeId typeId{ 0 };
+
+			// Name of the System type
+			std::string name;
+
+			// Number of Entities attached to the System
+			std::size_t entityCount{ 0 };
+
+			// Memory of the Entity lists and statuses of the System
+			MemoryUsage memory;
+		};
+
+		// Entity table, including the list of Systems of each Entity
+		MemoryUsage entities;
+
+		// Pending Entity actions and modified Entities
+		MemoryUsage actions;
+
+		// IDs of the removed Entities, waiting to be reused
+		MemoryUsage entityIds;
+
+		// Component masks of the Entities
+		MemoryUsage componentMasks;
+
+		// Components, by type
+		std::vector<Component> components;
+
+		// Systems
+		std::vector<System> systems;
+
+		// Entities of the Queries
+		MemoryUsage queries;
+
+		// Entity names
+		MemoryUsage names;
+
+		// Event listeners
+		MemoryUsage events;
+
+		// Temporary allocations of the current frame
+		MemoryUsage frameArena;
+
+		// Get the memory used by the whole World
+		MemoryUsage total() const noexcept
+		{
+			auto memory{ entities };
+
+			memory += actions;
+			memory += entityIds;
+			memory += componentMasks;
+			memory += queries;
+			memory += names;
+			memory += events;
+			memory += frameArena;
+
+			for (auto const &component : components)
+			{
+				memory += component.memory;
+			}
+
+			for (auto const &system : systems)
+			{
+				memory += system.memory;
+			}
+
+			return memory;
+		}
+	};
+}
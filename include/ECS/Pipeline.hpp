@@ -0,0 +1,79 @@
+// Copyright (c) 2021 Ethan Margaillan <contact@ethan.jp>.
+// Licensed under the MIT License - https://raw.githubusercontent.com/Ethan13310/ECS/master/LICENSE
+
+#pragma once
+
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+
+#include <ECS/Detail/TypeList.hpp>
+#include <ECS/ErrorReport.hpp>
+#include <ECS/System.hpp>
+
+namespace ecs
+{
+	// Error policy of a Pipeline: the exceptions thrown by the Systems are
+	// reported to the ErrorReport of the World, as for the Systems updated
+	// by the World
+	struct ReportErrors
+	{
+		template <class Func>
+		static void call(ErrorReport &errorReport, std::string_view site, Func &&func);
+	};
+
+	// Error policy of a Pipeline: the exceptions thrown by the Systems are
+	// propagated to the caller of update(), and the following Systems are
+	// not updated
+	struct PropagateErrors
+	{
+		template <class Func>
+		static void call(ErrorReport &errorReport, std::string_view site, Func &&func);
+	};
+
+	// Statically composed sequence of Systems
+	// The Systems are updated in order by direct, non-virtual calls to their
+	// onUpdate() then onPostUpdate() functions, which the compiler can inline
+	// The Systems must have been added to the World, which keeps attaching
+	// their Entities and triggering their other events, but no longer updates
+	// them while a Pipeline holding them exists
+	// The Systems must not be removed before the Pipeline is destroyed
+	template <class ErrorPolicy, class... Systems>
+	class BasicPipeline
+	{
+	public:
+		static_assert((std::is_base_of<System, Systems>::value && ...), "Systems must be Systems.");
+		static_assert(detail::isUnique<Systems...>(), "Systems must be unique.");
+
+		explicit BasicPipeline(World &world);
+		~BasicPipeline();
+
+		BasicPipeline(BasicPipeline const &) = delete;
+		BasicPipeline(BasicPipeline &&) = delete;
+
+		BasicPipeline &operator=(BasicPipeline const &) = delete;
+		BasicPipeline &operator=(BasicPipeline &&) = delete;
+
+		// Update the Systems, then post-update them
+		// Should be called after World::update(), which processes the
+		// Entity actions and starts the new Systems
+		void update(float elapsed);
+
+		// Get a System of the Pipeline
+		template <class T>
+		T &getSystem() noexcept;
+
+	private:
+		// Report of the errors of the World
+		ErrorReport &m_errorReport;
+
+		// Systems of the Pipeline
+		std::tuple<Systems &...> m_systems;
+	};
+
+	// Pipeline reporting the exceptions thrown by its Systems
+	template <class... Systems>
+	using Pipeline = BasicPipeline<ReportErrors, Systems...>;
+}
+
+#include <ECS/Pipeline.inl>
@@ -0,0 +1,58 @@
+// Copyright (c) 2021 Ethan Margaillan <contact@ethan.jp>.
+// Licensed under the MIT License - https://raw.githubusercontent.com/Ethan13310/ECS/master/LICENSE
+
+#pragma once
+
+#include <exception>
+#include <utility>
+
+#include <ECS/ErrorReport.hpp>
+#include <ECS/World.hpp>
+
+template <class Func>
+void ecs::ReportErrors::call(ErrorReport &errorReport, std::string_view site, Func &&func)
+{
+	try
+	{
+		func();
+	}
+	catch (std::exception const &e)
+	{
+		errorReport.report(site, e.what());
+	}
+}
+
+template <class Func>
+void ecs::PropagateErrors::call(ErrorReport &, std::string_view, Func &&func)
+{
+	func();
+}
+
+template <class ErrorPolicy, class... Systems>
+ecs::BasicPipeline<ErrorPolicy, Systems...>::BasicPipeline(World &world) :
+	m_errorReport{ world.getErrorReport() },
+	m_systems{ world.getSystem<Systems>()... }
+{
+	(++getSystem<Systems>().m_pipelined, ...);
+}
+
+template <class ErrorPolicy, class... Systems>
+ecs::BasicPipeline<ErrorPolicy, Systems...>::~BasicPipeline()
+{
+	(--getSystem<Systems>().m_pipelined, ...);
+}
+
+template <class ErrorPolicy, class... Systems>
+void ecs::BasicPipeline<ErrorPolicy, Systems...>::update(float elapsed)
+{
+	// The qualified calls bypass the virtual dispatch
+	(ErrorPolicy::call(m_errorReport, "ecs::Pipeline::update()", [&] { getSystem<Systems>().Systems::onUpdate(elapsed); }), ...);
+	(ErrorPolicy::call(m_errorReport, "ecs::Pipeline::update()", [&] { getSystem<Systems>().Systems::onPostUpdate(elapsed); }), ...);
+}
+
+template <class ErrorPolicy, class... Systems>
+template <class T>
+T &ecs::BasicPipeline<ErrorPolicy, Systems...>::getSystem() noexcept
+{
+	return std::get<T &>(m_systems);
+}
@@ -0,0 +1,213 @@
+// Copyright (c) 2021 Ethan Margaillan <contact@ethan.jp>.
+// Licensed under the MIT License - https://raw.githubusercontent.com/Ethan13310/ECS/master/LICENSE
+
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include <ECS/Detail/PerfCounters.hpp>
+#include <ECS/Detail/TypeInfo.hpp>
+#include <ECS/System.hpp>
+
+namespace ecs
+{
+	// Timing of the steps of World::update()
+	//
+	// When enabled, the World measures each update, the processing of the
+	// Entity actions, and the start, update and post-update events of each
+	// System. The measures can be aggregated into statistics, and recorded
+	// into a Chrome trace file which can be opened with chrome://tracing or
+	// Perfetto.
+	// On Linux, hardware performance counters can be measured as well.
+	class Profiler
+	{
+	public:
+		using Clock = std::chrono::steady_clock;
+
+		// Hardware performance counters
+		// A counter is empty if it is not available
+		struct Counters
+		{
+			std::optional<std::uint64_t> cycles;
+			std::optional<std::uint64_t> instructions;
+			std::optional<std::uint64_t> cacheMisses;
+			std::optional<std::uint64_t> branchMisses;
+		};
+
+		struct Stats
+		{
+			// Name of the step
+			std::string name;
+
+			// Number of measures
+			std::size_t calls{ 0 };
+
+			// Duration of the step
+			Clock::duration min{ 0 };
+			Clock::duration average{ 0 };
+			Clock::duration p99{ 0 };
+			Clock::duration max{ 0 };
+
+			// Total duration of the step
+			Clock::duration total{ 0 };
+
+			// Number of Entities of the System, or number of Entity actions
+			// processed, during the last measure
+			std::size_t entityCount{ 0 };
+
+			// Hardware counters during the last measure
+			// Empty if the counters could not be read during the last measure
+			Counters counters;
+
+			// Average hardware counters, over the measures during which the
+			// counters could be read
+			Counters averageCounters;
+		};
+
+		Profiler() = default;
+		~Profiler() = default;
+
+		Profiler(Profiler const &) = delete;
+		Profiler(Profiler &&) = default;
+
+		Profiler &operator=(Profiler const &) = delete;
+		Profiler &operator=(Profiler &&) = default;
+
+		// Enable or disable the measures
+		void enable(bool enable = true) noexcept;
+
+		// Check whether the measures are enabled
+		bool isEnabled() const noexcept;
+
+		// Get the statistics of all the steps, the longest first
+		// The 99th percentile is computed over the last measures only
+		std::vector<Stats> getStats() const;
+
+		// Remove all the measures
+		void reset();
+
+		// Record the measures into a Chrome trace file, until stopTrace() is called
+		// The measures are enabled as well
+		void startTrace(std::string path);
+
+		// Write the recorded measures into the trace file
+		void stopTrace();
+
+		// Check whether the measures are being recorded into a trace file
+		bool isTracing() const noexcept;
+
+		// Enable or disable the hardware performance counters (Linux only)
+		// The counters are those of the calling thread, which must be the
+		// thread updating the World
+		// Return false if no counter is available, in which case only the
+		// durations are measured
+		bool enableCounters(bool enable = true);
+
+		// Check whether the hardware performance counters are enabled
+		bool countersEnabled() const noexcept;
+
+	private:
+		// Steps of World::update()
+		enum class Step
+		{
+			Frame,
+			UpdateEntities,
+			Start,
+			Update,
+			PostUpdate
+		};
+
+		struct Section
+		{
+			// Name of the step
+			std::string name;
+
+			// Aggregated measures
+			std::size_t calls{ 0 };
+			Clock::duration min{ Clock::duration::max() };
+			Clock::duration max{ 0 };
+			Clock::duration total{ 0 };
+			std::size_t entityCount{ 0 };
+
+			// Hardware counters, counted only when they could be read
+			// before and after the measure
+			std::optional<detail::PerfCounters::Values> counters;
+			detail::PerfCounters::Values totalCounters{};
+			std::size_t counterCalls{ 0 };
+
+			// Last measures, used as a ring buffer
+			std::vector<Clock::duration> samples;
+		};
+
+		struct TraceEvent
+		{
+			std::size_t section;
+			Clock::time_point start;
+			Clock::duration duration;
+			std::size_t entityCount;
+			std::optional<detail::PerfCounters::Values> counters;
+		};
+
+		// Name the steps of a System
+		// typeName is the name given by std::type_info
+		void addSystem(detail::TypeId systemId, char const *typeName);
+
+		// Measure a step
+		// system is the System whose event is called, or nullptr
+		template <class Func>
+		void measure(Step step, detail::TypeId systemId, System const *system, Func &&func);
+
+		// Measure the processing of the Entity actions
+		template <class Func>
+		void measure(Step step, std::size_t entityCount, Func &&func);
+
+		// Get the section of a step, creating it if necessary
+		std::size_t getSection(Step step, detail::TypeId systemId);
+
+		// Add a measure to a section
+		// before holds the counters read before the measure, if they could be read
+		void record(std::size_t section, Clock::time_point start, Clock::time_point end, std::size_t entityCount, std::optional<detail::PerfCounters::Values> const &before);
+
+		// Convert counter values into Counters, keeping the available ones only
+		Counters getCounters(std::optional<detail::PerfCounters::Values> const &values) const;
+
+		// Number of measures kept to compute the percentiles
+		static constexpr std::size_t SAMPLE_COUNT{ 1024 };
+
+		// Are the measures enabled
+		bool m_enabled{ false };
+
+		// Measured steps
+		std::vector<Section> m_sections;
+
+		// Section of each step, by step and System type ID
+		std::unordered_map<std::uint64_t, std::size_t> m_sectionIds;
+
+		// Name of each System type
+		std::unordered_map<detail::TypeId, std::string> m_systemNames;
+
+		// Trace file path, empty if the measures are not recorded
+		std::string m_tracePath;
+
+		// Recorded measures
+		std::vector<TraceEvent> m_traceEvents;
+
+		// Time the trace has been started
+		Clock::time_point m_traceStart;
+
+		// Hardware performance counters, when enabled
+		detail::PerfCounters m_counters;
+
+		// Only World measures its update
+		friend class World;
+	};
+}
+
+#include <ECS/Profiler.inl>
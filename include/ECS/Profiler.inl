@@ -0,0 +1,42 @@
+// Copyright (c) 2021 Ethan Margaillan <contact@ethan.jp>.
+// Licensed under the MIT License - https://raw.githubusercontent.com/Ethan13310/ECS/master/LICENSE
+
+#pragma once
+
+#include <utility>
+
+template <class Func>
+void ecs::Profiler::measure(Step step, detail::TypeId systemId, System const *system, Func &&func)
+{
+	if (!m_enabled)
+	{
+		std::forward<Func>(func)();
+		return;
+	}
+
+	auto const section{ getSection(step, systemId) };
+	auto const counters{ m_counters.read() };
+	auto const start{ Clock::now() };
+
+	std::forward<Func>(func)();
+
+	record(section, start, Clock::now(), system != nullptr ? system->getEntityCount() : 0, counters);
+}
+
+template <class Func>
+void ecs::Profiler::measure(Step step, std::size_t entityCount, Func &&func)
+{
+	if (!m_enabled)
+	{
+		std::forward<Func>(func)();
+		return;
+	}
+
+	auto const section{ getSection(step, 0) };
+	auto const counters{ m_counters.read() };
+	auto const start{ Clock::now() };
+
+	std::forward<Func>(func)();
+
+	record(section, start, Clock::now(), entityCount, counters);
+}
@@ -0,0 +1,87 @@
+// Copyright (c) 2021 Ethan Margaillan <contact@ethan.jp>.
+// Licensed under the MIT License - https://raw.githubusercontent.com/Ethan13310/ECS/master/LICENSE
+
+#pragma once
+
+#include <cstddef>
+#include <limits>
+#include <memory_resource>
+#include <vector>
+
+#include <ECS/Detail/ComponentFilter.hpp>
+#include <ECS/Entity.hpp>
+#include <ECS/MemoryStats.hpp>
+
+namespace ecs
+{
+	// Enabled Entities of a World which match a filter
+	// The list is kept up to date by the World as the Entities change,
+	// like the Entities attached to the Systems
+	// A Query is owned by its World and shared by all those who request the
+	// same filter
+	class Query
+	{
+	public:
+		// The Entities are allocated from the memory resource
+		Query(detail::ComponentFilter const &filter, std::pmr::memory_resource *resource);
+		~Query() = default;
+
+		Query(Query const &) = delete;
+		Query(Query &&) = default;
+
+		Query &operator=(Query const &) = delete;
+		Query &operator=(Query &&) = default;
+
+		// Get the matching Entities
+		// Their order changes as Entities are removed from the Query
+		std::pmr::vector<Entity> const &getEntities() const noexcept;
+
+		// Get the number of matching Entities
+		std::size_t getEntityCount() const noexcept;
+
+		// Check whether the Entity matches the Query
+		bool contains(Entity::Id id) const noexcept;
+
+		// Get the filter of the Query
+		detail::ComponentFilter const &getFilter() const noexcept;
+
+		// Iterate through all matching Entities
+		template <class Func>
+		void forEach(Func &&func);
+
+	private:
+		// Invalid index
+		static constexpr std::size_t npos{ std::numeric_limits<std::size_t>::max() };
+
+		// Add an Entity to the Query, if not already
+		void insert(Entity const &entity);
+
+		// Remove an Entity from the Query, if present
+		void erase(Entity::Id id);
+
+		// Remove all Entities
+		void clear() noexcept;
+
+		// Forget the Entity IDs from size onwards and release the unused memory
+		// None of these Entities must be part of the Query
+		void shrinkToFit(std::size_t size);
+
+		// Get the memory used by the Entities
+		MemoryUsage getMemoryUsage() const noexcept;
+
+		// The filter the Entities match
+		detail::ComponentFilter m_filter;
+
+		// Matching Entities
+		std::pmr::vector<Entity> m_entities;
+
+		// Index of each Entity within m_entities, or npos
+		// The index of this array matches the Entity ID
+		std::pmr::vector<std::size_t> m_indices;
+
+		// Only World maintains the list of Entities
+		friend class World;
+	};
+}
+
+#include <ECS/Query.inl>
@@ -0,0 +1,13 @@
+// Copyright (c) 2021 Ethan Margaillan <contact@ethan.jp>.
+// Licensed under the MIT License - https://raw.githubusercontent.com/Ethan13310/ECS/master/LICENSE
+
+#pragma once
+
+template <class Func>
+void ecs::Query::forEach(Func &&func)
+{
+	for (auto const &entity : m_entities)
+	{
+		func(entity);
+	}
+}
@@ -0,0 +1,131 @@
+// Copyright (c) 2021 Ethan Margaillan <contact@ethan.jp>.
+// Licensed under the MIT License - https://raw.githubusercontent.com/Ethan13310/ECS/master/LICENSE
+
+#pragma once
+
+#include <cstdint>
+#include <istream>
+#include <ostream>
+
+#include <ECS/ComponentRegistry.hpp>
+#include <ECS/Detail/Reference.hpp>
+
+namespace ecs
+{
+	class World;
+	class WorldState;
+
+	// Binary snapshot format version
+	constexpr std::uint32_t SNAPSHOT_VERSION = 1;
+
+	// Write the content of a World into a binary snapshot
+	//
+	// The snapshot contains the Entity table (validity, enabled state, free IDs),
+	// the Entity names and, for each registered Component type, the IDs of the
+	// Entities owning it followed by the raw Component data, as two contiguous
+	// columns. Unregistered Component types are not saved.
+	// Values are stored with the byte order of the host.
+	class SnapshotWriter
+	{
+	public:
+		explicit SnapshotWriter(ComponentRegistry const &registry);
+		~SnapshotWriter() = default;
+
+		SnapshotWriter(SnapshotWriter const &) = default;
+		SnapshotWriter(SnapshotWriter &&) = default;
+
+		SnapshotWriter &operator=(SnapshotWriter const &) = default;
+		SnapshotWriter &operator=(SnapshotWriter &&) = default;
+
+		// Write the World into the stream
+		// Entity actions which have not been processed yet are not saved
+		void write(World const &world, std::ostream &stream) const;
+
+	private:
+		// Registered Components
+		detail::Reference<ComponentRegistry const> m_registry;
+	};
+
+	// Restore the content of a World from a binary snapshot
+	//
+	// All the Entities of the World are removed, then the Entities of the
+	// snapshot are restored with their original IDs. The Entities are attached
+	// to the Systems during the next update of the World.
+	// Columns of unregistered Component types are skipped.
+	class SnapshotReader
+	{
+	public:
+		explicit SnapshotReader(ComponentRegistry const &registry);
+		~SnapshotReader() = default;
+
+		SnapshotReader(SnapshotReader const &) = default;
+		SnapshotReader(SnapshotReader &&) = default;
+
+		SnapshotReader &operator=(SnapshotReader const &) = default;
+		SnapshotReader &operator=(SnapshotReader &&) = default;
+
+		// Read the stream into the World
+		// The World is left untouched if the snapshot is invalid
+		void read(World &world, std::istream &stream) const;
+
+	private:
+		// Registered Components
+		detail::Reference<ComponentRegistry const> m_registry;
+	};
+
+	// Write the modifications made to a World since a state has been saved
+	//
+	// Only the Entities which have been created, removed or modified since the
+	// baseline has been saved are written, along with their registered Components
+	// which are new or whose data differ from the baseline.
+	// The World keeps track of the modified Entities: creating, enabling,
+	// disabling or removing an Entity, adding or removing Components, and
+	// accessing a Component through a non-const Entity mark it as modified.
+	class DeltaWriter
+	{
+	public:
+		explicit DeltaWriter(ComponentRegistry const &registry);
+		~DeltaWriter() = default;
+
+		DeltaWriter(DeltaWriter const &) = default;
+		DeltaWriter(DeltaWriter &&) = default;
+
+		DeltaWriter &operator=(DeltaWriter const &) = default;
+		DeltaWriter &operator=(DeltaWriter &&) = default;
+
+		// Write the modifications made to the World since the baseline has been saved
+		// The baseline must have been saved from this World
+		void write(World const &world, WorldState const &baseline, std::ostream &stream) const;
+
+	private:
+		// Registered Components
+		detail::Reference<ComponentRegistry const> m_registry;
+	};
+
+	// Apply the modifications written by a DeltaWriter to a World
+	//
+	// The World must be in the state of the baseline the delta has been made
+	// from. Entities are created and removed with their original IDs, and the
+	// modified Entities are refreshed during the next update of the World.
+	// Components of unregistered types are skipped.
+	class DeltaReader
+	{
+	public:
+		explicit DeltaReader(ComponentRegistry const &registry);
+		~DeltaReader() = default;
+
+		DeltaReader(DeltaReader const &) = default;
+		DeltaReader(DeltaReader &&) = default;
+
+		DeltaReader &operator=(DeltaReader const &) = default;
+		DeltaReader &operator=(DeltaReader &&) = default;
+
+		// Read the stream and apply the modifications to the World
+		// The World is left untouched if the delta is invalid
+		void apply(World &world, std::istream &stream) const;
+
+	private:
+		// Registered Components
+		detail::Reference<ComponentRegistry const> m_registry;
+	};
+}
@@ -0,0 +1,19 @@
+// Copyright (c) 2021 Ethan Margaillan <contact@ethan.jp>.
+// Licensed under the MIT License - https://raw.githubusercontent.com/Ethan13310/ECS/master/LICENSE
+
+#pragma once
+
+namespace ecs
+{
+	// How the Components and the Entities are sorted
+	// Both modes are stable: equivalent elements keep their relative order
+	enum class SortMode
+	{
+		// Merge sort, for data in any order
+		Full,
+
+		// Insertion sort, linear on data which is already nearly sorted,
+		// such as data sorted on the previous frame
+		Incremental
+	};
+}
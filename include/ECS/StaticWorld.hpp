@@ -0,0 +1,130 @@
+// Copyright (c) 2021 Ethan Margaillan <contact@ethan.jp>.
+// Licensed under the MIT License - https://raw.githubusercontent.com/Ethan13310/ECS/master/LICENSE
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+#include <ECS/Component.hpp>
+#include <ECS/Detail/EntityPool.hpp>
+#include <ECS/Detail/StaticPool.hpp>
+#include <ECS/Detail/TypeList.hpp>
+#include <ECS/Entity.hpp>
+
+namespace ecs
+{
+	// World whose Component types are known at compile time
+	// Each Component type has its own typed pool, its type ID is its index
+	// within Components, and the masks of the queries are computed at compile
+	// time, so accessing the Components does not go through any indirection
+	// The Entities are plain IDs, and there are no Systems nor Events
+	template <class... Components>
+	class StaticWorld
+	{
+	public:
+		static_assert((std::is_base_of<Component, Components>::value && ...), "Components must be Components.");
+		static_assert(detail::isUnique<Components...>(), "Components must be unique.");
+		static_assert(sizeof...(Components) <= 64, "StaticWorld cannot hold more than 64 Components.");
+
+		// Components held by an Entity, one bit per Component type
+		using Mask = std::uint64_t;
+
+		StaticWorld() = default;
+		~StaticWorld() = default;
+
+		StaticWorld(StaticWorld const &) = delete;
+		StaticWorld(StaticWorld &&) = default;
+
+		StaticWorld &operator=(StaticWorld const &) = delete;
+		StaticWorld &operator=(StaticWorld &&) = default;
+
+		// Get the type ID of the Component T, which is its index within Components
+		template <class T>
+		static constexpr std::size_t getComponentTypeId() noexcept;
+
+		// Get the mask of the Components Ts
+		template <class... Ts>
+		static constexpr Mask getMask() noexcept;
+
+		// Create a new Entity
+		Entity::Id createEntity();
+
+		// Remove the Entity and its Components
+		void removeEntity(Entity::Id id);
+
+		// Remove all Entities
+		void clear() noexcept;
+
+		// Check whether an Entity is valid
+		bool isEntityValid(Entity::Id id) const noexcept;
+
+		// Get the number of valid Entities
+		std::size_t getEntityCount() const noexcept;
+
+		// Construct the Component T of the Entity
+		// The previous Component of the Entity, if any, is replaced
+		template <class T, class... Args>
+		T &addComponent(Entity::Id id, Args &&...args);
+
+		// Get the Component T of the Entity
+		template <class T>
+		T &getComponent(Entity::Id id);
+
+		// Get the Component T of the Entity
+		template <class T>
+		T const &getComponent(Entity::Id id) const;
+
+		// Check whether the Entity has the Component T
+		template <class T>
+		bool hasComponent(Entity::Id id) const noexcept;
+
+		// Remove the Component T from the Entity
+		template <class T>
+		void removeComponent(Entity::Id id);
+
+		// Get the Component mask of the Entity
+		Mask getComponentsMask(Entity::Id id) const noexcept;
+
+		// Get the pool of the Components T, whose packed array can be
+		// processed directly
+		template <class T>
+		detail::StaticPool<T> &getPool() noexcept;
+
+		// Get the pool of the Components T
+		template <class T>
+		detail::StaticPool<T> const &getPool() const noexcept;
+
+		// Iterate through the Entities which have all the Components Ts
+		// Func is called with the Entity ID and a reference to each Component
+		// The Components of the first type are iterated in storage order, so
+		// the rarest Component should come first
+		// The Entities and their Components must not be added or removed
+		// during the iteration
+		template <class... Ts, class Func>
+		void forEach(Func &&func);
+
+	private:
+		// Component mask of each Entity
+		// The index of this array matches the Entity ID
+		std::vector<Mask> m_masks;
+
+		// Is each Entity valid
+		// The index of this array matches the Entity ID
+		std::vector<bool> m_valid;
+
+		// Number of valid Entities
+		std::size_t m_entityCount{ 0 };
+
+		// ID pool
+		detail::EntityPool m_pool;
+
+		// Pool of each Component type
+		std::tuple<detail::StaticPool<Components>...> m_pools;
+	};
+}
+
+#include <ECS/StaticWorld.inl>
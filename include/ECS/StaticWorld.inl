@@ -0,0 +1,192 @@
+// Copyright (c) 2021 Ethan Margaillan <contact@ethan.jp>.
+// Licensed under the MIT License - https://raw.githubusercontent.com/Ethan13310/ECS/master/LICENSE
+
+#pragma once
+
+#include <utility>
+
+#include <ECS/Exceptions/Exception.hpp>
+#include <ECS/Exceptions/InvalidEntity.hpp>
+
+template <class... Components>
+template <class T>
+constexpr std::size_t ecs::StaticWorld<Components...>::getComponentTypeId() noexcept
+{
+	static_assert(detail::contains<T, Components...>(), "T is not a Component of this World.");
+
+	return detail::indexOf<T, Components...>();
+}
+
+template <class... Components>
+template <class... Ts>
+constexpr typename ecs::StaticWorld<Components...>::Mask ecs::StaticWorld<Components...>::getMask() noexcept
+{
+	return (Mask{ 0 } | ... | (Mask{ 1 } << getComponentTypeId<Ts>()));
+}
+
+template <class... Components>
+ecs::Entity::Id ecs::StaticWorld<Components...>::createEntity()
+{
+	auto const id{ m_pool.create() };
+
+	if (id >= m_masks.size())
+	{
+		m_masks.resize(id + 1, 0);
+		m_valid.resize(id + 1, false);
+	}
+
+	m_masks[id] = 0;
+	m_valid[id] = true;
+	++m_entityCount;
+
+	return id;
+}
+
+template <class... Components>
+void ecs::StaticWorld<Components...>::removeEntity(Entity::Id id)
+{
+	if (!isEntityValid(id))
+	{
+		throw InvalidEntity{ "ecs::StaticWorld::removeEntity()" };
+	}
+
+	(std::get<detail::StaticPool<Components>>(m_pools).remove(id), ...);
+
+	m_masks[id] = 0;
+	m_valid[id] = false;
+	--m_entityCount;
+
+	m_pool.store(id);
+}
+
+template <class... Components>
+void ecs::StaticWorld<Components...>::clear() noexcept
+{
+	(std::get<detail::StaticPool<Components>>(m_pools).clear(), ...);
+
+	m_masks.clear();
+	m_valid.clear();
+	m_entityCount = 0;
+
+	m_pool.reset();
+}
+
+template <class... Components>
+bool ecs::StaticWorld<Components...>::isEntityValid(Entity::Id id) const noexcept
+{
+	return id < m_valid.size() && m_valid[id];
+}
+
+template <class... Components>
+std::size_t ecs::StaticWorld<Components...>::getEntityCount() const noexcept
+{
+	return m_entityCount;
+}
+
+template <class... Components>
+template <class T, class... Args>
+T &ecs::StaticWorld<Components...>::addComponent(Entity::Id id, Args &&...args)
+{
+	if (!isEntityValid(id))
+	{
+		throw InvalidEntity{ "ecs::StaticWorld::addComponent()" };
+	}
+
+	auto &component{ getPool<T>().emplace(id, std::forward<Args>(args)...) };
+	m_masks[id] |= getMask<T>();
+
+	return component;
+}
+
+template <class... Components>
+template <class T>
+T &ecs::StaticWorld<Components...>::getComponent(Entity::Id id)
+{
+	if (!hasComponent<T>(id))
+	{
+		throw Exception{ "Entity does not have this Component.", "ecs::StaticWorld::getComponent()" };
+	}
+
+	return getPool<T>().get(id);
+}
+
+template <class... Components>
+template <class T>
+T const &ecs::StaticWorld<Components...>::getComponent(Entity::Id id) const
+{
+	if (!hasComponent<T>(id))
+	{
+		throw Exception{ "Entity does not have this Component.", "ecs::StaticWorld::getComponent()" };
+	}
+
+	return getPool<T>().get(id);
+}
+
+template <class... Components>
+template <class T>
+bool ecs::StaticWorld<Components...>::hasComponent(Entity::Id id) const noexcept
+{
+	return (getComponentsMask(id) & getMask<T>()) != 0;
+}
+
+template <class... Components>
+template <class T>
+void ecs::StaticWorld<Components...>::removeComponent(Entity::Id id)
+{
+	if (!isEntityValid(id))
+	{
+		throw InvalidEntity{ "ecs::StaticWorld::removeComponent()" };
+	}
+
+	getPool<T>().remove(id);
+	m_masks[id] &= ~getMask<T>();
+}
+
+template <class... Components>
+typename ecs::StaticWorld<Components...>::Mask ecs::StaticWorld<Components...>::getComponentsMask(Entity::Id id) const noexcept
+{
+	return id < m_masks.size() ? m_masks[id] : 0;
+}
+
+template <class... Components>
+template <class T>
+ecs::detail::StaticPool<T> &ecs::StaticWorld<Components...>::getPool() noexcept
+{
+	return std::get<getComponentTypeId<T>()>(m_pools);
+}
+
+template <class... Components>
+template <class T>
+ecs::detail::StaticPool<T> const &ecs::StaticWorld<Components...>::getPool() const noexcept
+{
+	return std::get<getComponentTypeId<T>()>(m_pools);
+}
+
+template <class... Components>
+template <class... Ts, class Func>
+void ecs::StaticWorld<Components...>::forEach(Func &&func)
+{
+	static_assert(sizeof...(Ts) > 0, "At least one Component must be iterated.");
+
+	using First = std::tuple_element_t<0, std::tuple<Ts...>>;
+
+	constexpr auto mask{ getMask<Ts...>() };
+
+	auto &pool{ getPool<First>() };
+	auto const &entities{ pool.getEntities() };
+	auto const components{ pool.data() };
+
+	for (std::size_t index{ 0 }; index < pool.size(); ++index)
+	{
+		auto const id{ entities[index] };
+
+		if constexpr (sizeof...(Ts) == 1)
+		{
+			func(id, components[index]);
+		}
+		else if ((m_masks[id] & mask) == mask)
+		{
+			func(id, getPool<Ts>().get(id)...);
+		}
+	}
+}
@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include <memory_resource>
 #include <unordered_map>
 #include <unordered_set>
 #include <vector>
@@ -13,6 +14,8 @@
 #include <ECS/Entity.hpp>
 #include <ECS/Event.hpp>
 #include <ECS/EventDispatcher.hpp>
+#include <ECS/MemoryStats.hpp>
+#include <ECS/SortMode.hpp>
 
 namespace ecs
 {
@@ -21,6 +24,11 @@ namespace ecs
 		class SystemHolder;
 	}
 
+	class WorldState;
+
+	template <class ErrorPolicy, class... Systems>
+	class BasicPipeline;
+
 	class System
 	{
 	public:
@@ -33,7 +41,7 @@ namespace ecs
 		System &operator=(System &&) = default;
 
 		// Get Entities attached to this System
-		std::vector<Entity> const &getEntities() const;
+		std::pmr::vector<Entity> const &getEntities() const;
 
 		// Get the World that the System belongs to
 		World &getWorld();
@@ -51,6 +59,16 @@ namespace ecs
 		template <class Func>
 		void forEach(Func &&func);
 
+		// Sort the enabled Entities by their Component T
+		// Compare is called with two Components T, and returns whether the
+		// first one goes before the second one
+		// The Entities which do not have the Component T go last
+		// Both modes are stable, and the order is kept until Entities are
+		// attached or enabled, which adds them at the end: SortMode::Incremental
+		// then moves them into place at little cost
+		template <class T, class Compare>
+		void sort(Compare &&compare, SortMode mode = SortMode::Full);
+
 		// Triggered on System start up
 		virtual void onStart();
 
@@ -104,9 +122,28 @@ namespace ecs
 			Disabled
 		};
 
+		// Entities attached to the System, saved by World::saveState
+		struct State
+		{
+			std::pmr::vector<Entity> enabledEntities;
+			std::pmr::vector<Entity> disabledEntities;
+			std::pmr::unordered_map<Entity::Id, EntityStatus> status;
+		};
+
+		// Allocate the attached Entities and the Events from the memory resource
+		// No Entity must be attached yet
+		void setMemoryResource(std::pmr::memory_resource *resource);
+
 		// Attach an Entity to the System
 		void attachEntity(Entity const &entity);
 
+		// Attach an Entity which is not attached yet, directly as enabled or disabled
+		// Unlike attachEntity then enableEntity, the lists are not searched
+		void attachNewEntity(Entity const &entity, bool enabled);
+
+		// Reserve the memory to attach more enabled and disabled Entities
+		void reserve(std::size_t enabled, std::size_t disabled);
+
 		// Detach an Entity from the System
 		void detachEntity(Entity const &entity);
 
@@ -150,14 +187,26 @@ namespace ecs
 		// Set Entity status
 		void setEntityStatus(Entity::Id id, EntityStatus status);
 
+		// Save the attached Entities
+		void saveState(State &state) const;
+
+		// Restore the attached Entities, without triggering any event
+		void restoreState(State const &state);
+
+		// Get the memory used by the attached Entities and their statuses
+		MemoryUsage getMemoryUsage() const noexcept;
+
+		// Release the memory which is not used by the attached Entities
+		void shrinkToFit();
+
 		// Enabled Entities attached to this System
-		std::vector<Entity> m_enabledEntities;
+		std::pmr::vector<Entity> m_enabledEntities;
 
 		// Disabled Entities attached to this System
-		std::vector<Entity> m_disabledEntities;
+		std::pmr::vector<Entity> m_disabledEntities;
 
 		// Entities status (enabled/disabled)
-		std::unordered_map<Entity::Id, EntityStatus> m_status;
+		std::pmr::unordered_map<Entity::Id, EntityStatus> m_status;
 
 		// The World that this System belongs to
 		detail::OptionalReference<World> m_world;
@@ -167,13 +216,23 @@ namespace ecs
 		detail::ComponentFilter m_filter;
 
 		// List of the Events this System is listening to
-		std::unordered_set<std::size_t> m_events;
+		std::pmr::unordered_set<std::size_t> m_events;
+
+		// Number of Pipelines updating this System instead of the World
+		std::size_t m_pipelined{ 0 };
 
 		// Only World can access detail::ComponentFilter
 		friend class World;
 
 		// detail::SystemHolder needs to trigger onShutdown event
 		friend class detail::SystemHolder;
+
+		// WorldState stores the attached Entities
+		friend class WorldState;
+
+		// BasicPipeline takes over the update of the System
+		template <class ErrorPolicy, class... Systems>
+		friend class BasicPipeline;
 	};
 
 	// Get the Type ID for the System T
@@ -6,8 +6,9 @@
 #include <type_traits>
 #include <utility>
 
+#include <ECS/Detail/Sort.hpp>
+#include <ECS/ErrorReport.hpp>
 #include <ECS/EventDispatcher.hpp>
-#include <ECS/Log.hpp>
 #include <ECS/World.hpp>
 
 template <class Func>
@@ -22,6 +23,27 @@ void ecs::System::forEach(Func &&func)
 	}
 }
 
+template <class T, class Compare>
+void ecs::System::sort(Compare &&compare, SortMode mode)
+{
+	static_assert(std::is_base_of<Component, T>::value, "T must be a Component.");
+
+	auto &components{ getWorld().m_components };
+
+	detail::sort(m_enabledEntities.begin(), m_enabledEntities.end(), [&](Entity const &lhs, Entity const &rhs)
+	{
+		auto const lhsHas{ components.template hasComponent<T>(lhs.getId()) };
+		auto const rhsHas{ components.template hasComponent<T>(rhs.getId()) };
+
+		if (!lhsHas || !rhsHas)
+		{
+			return lhsHas && !rhsHas;
+		}
+
+		return compare(std::as_const(components.template getComponent<T>(lhs.getId())), std::as_const(components.template getComponent<T>(rhs.getId())));
+	}, mode);
+}
+
 template <class T>
 void ecs::System::emitEvent(T const &evt) const
 {
@@ -48,7 +70,7 @@ void ecs::System::callEvent(Func &&func)
 	}
 	catch (std::exception const &e)
 	{
-		Log::error(e.what());
+		getWorld().getErrorReport().report("ecs::System::callEvent()", e.what());
 	}
 }
 
@@ -3,31 +3,58 @@
 
 #pragma once
 
+#include <cstdint>
+#include <memory>
+#include <memory_resource>
 #include <optional>
 #include <string>
+#include <string_view>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
 #include <ECS/Component.hpp>
 #include <ECS/Detail/ComponentFilter.hpp>
 #include <ECS/Detail/ComponentHolder.hpp>
 #include <ECS/Detail/EntityPool.hpp>
+#include <ECS/Detail/FilterTraits.hpp>
+#include <ECS/Detail/FrameArena.hpp>
+#include <ECS/Detail/InstanceId.hpp>
+#include <ECS/Detail/NameTable.hpp>
 #include <ECS/Detail/Reference.hpp>
 #include <ECS/Detail/SystemHolder.hpp>
 #include <ECS/Detail/TypeInfo.hpp>
 #include <ECS/Entity.hpp>
+#include <ECS/ErrorReport.hpp>
 #include <ECS/EventDispatcher.hpp>
+#include <ECS/FrameStats.hpp>
+#include <ECS/HashedName.hpp>
+#include <ECS/MemoryStats.hpp>
+#include <ECS/Profiler.hpp>
+#include <ECS/Query.hpp>
+#include <ECS/SortMode.hpp>
 #include <ECS/System.hpp>
 
 namespace ecs
 {
+	class WorldState;
+
 	class World
 	{
 	public:
-		World() = default;
+		World();
+
+		// All the containers of the World, its Components and the Entity
+		// lists of its Systems are allocated from the memory resource,
+		// which must outlive the World
+		explicit World(std::pmr::memory_resource *resource);
+
 		~World();
 
 		World(World const &) = delete;
+
+		// The Entities and the Systems refer to their World by address, so a
+		// World must not be moved once it has Entities or Systems
 		World(World &&) = default;
 
 		World &operator=(World const &) = delete;
@@ -60,13 +87,16 @@ namespace ecs
 		Entity createEntity();
 
 		// Create a new named Entity
-		Entity createEntity(std::string const &name);
+		Entity createEntity(std::string_view name);
 
 		// Get Entity by ID
 		std::optional<ecs::Entity> getEntity(Entity::Id id) const;
 
 		// Get Entity by name
-		std::optional<ecs::Entity> getEntity(std::string const &name) const;
+		std::optional<ecs::Entity> getEntity(std::string_view name) const;
+
+		// Get Entity by name, using its precomputed hash
+		std::optional<ecs::Entity> getEntity(HashedName const &name) const;
 
 		// Get Entity name
 		std::string getEntityName(Entity::Id id) const;
@@ -89,15 +119,126 @@ namespace ecs
 		// Check whether an Entity is valid
 		bool isEntityValid(Entity::Id id) const;
 
+		// Get the Query of the Entities which match the Terms
+		// A Component alone stands for Require<T>, the other Terms being
+		// Require, Exclude, AnyOf and Optional
+		// The Query is filled on first request, then kept up to date and
+		// shared with all those who request the same filter until the World
+		// is destroyed
+		template <class... Terms>
+		Query &query();
+
+		// Get the Query of the Entities which match the filter
+		Query &query(detail::ComponentFilter const &filter);
+
+		// Sort the Components T, moving them within their pool so that they
+		// are stored in order
+		// Compare is called with two Components T, and returns whether the
+		// first one goes before the second one
+		// SortMode::Incremental suits Components which are still nearly
+		// sorted since the previous call
+		// If T is owned by a Group, the Group is sorted instead
+		// The Components T must be relocatable, and the references to them
+		// do not remain valid
+		template <class T, class Compare>
+		void sort(Compare &&compare, SortMode mode = SortMode::Full);
+
 		// Update the World
 		void update(float elapsed);
 
 		// Clear the World by removing all Systems and Entities
 		void clear();
 
+		// Release the memory which is not used anymore, typically after many
+		// Entities have been removed
+		// The removed Entities at the end of the Entity table are trimmed, their
+		// IDs will be given to the next created Entities
+		// The IDs of the remaining Entities, and the address of their Components,
+		// do not change
+		// Must not be called while the World is being updated
+		void shrinkToFit();
+
+		// Set the number of threads matching the existing Entities against the
+		// filter of the new Systems, 0 for one per hardware thread
+		// Only the filters which require no Component are matched by several
+		// threads, the others only visit the Entities having the Components
+		// The Entities are matched on the calling thread by default
+		void setAttachThreadCount(std::size_t count) noexcept;
+
+		// Get the memory resource used by the World
+		std::pmr::memory_resource *getMemoryResource() const noexcept;
+
+		// Get the memory resource for the temporary allocations of the current frame
+		// The memory is released all at once at the end of update(), so nothing
+		// allocated from it must be kept from one frame to the next
+		// Must only be used from the thread updating the World
+		std::pmr::memory_resource &getFrameResource() noexcept;
+
+		// Get the profiler measuring the updates of the World
+		Profiler &getProfiler() noexcept;
+
+		// Get the profiler measuring the updates of the World
+		Profiler const &getProfiler() const noexcept;
+
+		// Get the report of the errors caught during the updates
+		ErrorReport &getErrorReport() noexcept;
+
+		// Get the report of the errors caught during the updates
+		ErrorReport const &getErrorReport() const noexcept;
+
+		// Get the memory used by the World
+		MemoryStats memoryStats() const;
+
+		// Get the structural changes performed during the last frame,
+		// from the end of the update before the last one to the end of the last update
+		FrameStats const &getFrameStats() const noexcept;
+
+		// Save the Entities, their Components and their Systems into the state
+		// The memory already held by the state is reused
+		void saveState(WorldState &state) const;
+
+		// Restore the Entities, their Components and their Systems from the state,
+		// without triggering any System event
+		// The state must have been saved from this World, otherwise the World
+		// is not modified
+		// If an allocation or a Component copy fails while restoring, the World
+		// is left without any Entity rather than partially restored
+		void restoreState(WorldState const &state);
+
 	private:
 		struct EntityAttributes
 		{
+			// The list of Systems uses the allocator of the Entity table
+			using allocator_type = std::pmr::polymorphic_allocator<detail::TypeId>;
+
+			explicit EntityAttributes(allocator_type const &allocator = {}) :
+				systems{ allocator }
+			{}
+
+			EntityAttributes(EntityAttributes const &other, allocator_type const &allocator) :
+				entity{ other.entity },
+				isValid{ other.isValid },
+				isEnabled{ other.isEnabled },
+				isDisabled{ other.isDisabled },
+				systems{ other.systems, allocator },
+				version{ other.version }
+			{}
+
+			EntityAttributes(EntityAttributes &&other, allocator_type const &allocator) :
+				entity{ other.entity },
+				isValid{ other.isValid },
+				isEnabled{ other.isEnabled },
+				isDisabled{ other.isDisabled },
+				systems{ std::move(other.systems), allocator },
+				version{ other.version }
+			{}
+
+			EntityAttributes(EntityAttributes const &) = default;
+			EntityAttributes(EntityAttributes &&) = default;
+
+			EntityAttributes &operator=(EntityAttributes const &) = default;
+			EntityAttributes &operator=(EntityAttributes &&) = default;
+
 			// Entity
 			Entity entity;
 
@@ -107,11 +248,25 @@ namespace ecs
 			// Is this Entity enabled
 			bool isEnabled{ false };
 
-			// Entity name
-			std::optional<std::string> name;
+			// Has this Entity been disabled, and not enabled since
+			// Unlike isEnabled, it is cleared when the Entity is enabled again,
+			// so that only the actual changes are counted by the frame stats
+			bool isDisabled{ false };
 
 			// The Systems this Entity is attached
-			std::vector<detail::TypeId> systems;
+			std::pmr::vector<detail::TypeId> systems;
+
+			// Version of the World when this Entity was last modified
+			std::uint64_t version{ 0 };
+		};
+
+		struct EntityChange
+		{
+			// Version of the World when the Entity was modified
+			std::uint64_t version;
+
+			// Entity ID
+			Entity::Id id;
 		};
 
 		struct EntityAction
@@ -142,6 +297,15 @@ namespace ecs
 		// Refresh the Entity Systems list
 		void refreshEntity(Entity::Id id);
 
+		// Record that the Entity has been modified, for delta snapshots
+		void markChanged(Entity::Id id);
+
+		// Drop the modifications which are not the last one of their Entity
+		void pruneChanges();
+
+		// Count all the Components of the Entity as removed
+		void countRemovedComponents(Entity::Id id);
+
 		// Update the Systems
 		template <class Func>
 		void updateSystems(Func &&func);
@@ -166,6 +330,25 @@ namespace ecs
 		// Remove Entity data from the World
 		void actionRemove(Entity::Id id);
 
+		// Add the Entity to the Queries it matches, and remove it from those
+		// it does not match anymore
+		// The Entity only joins a Query when it is being enabled, or if it is enabled
+		void refreshQueries(Entity::Id id, bool enable);
+
+		// Remove the Entity from all Queries
+		void leaveQueries(Entity::Id id);
+
+		// Fill the Query with the enabled Entities which match its filter
+		void populateQuery(Query &query);
+
+		// Attach all the existing Entities which match the filter of a new System,
+		// in ID order
+		void attachExistingEntities(System &system, detail::TypeId systemId);
+
+		// Find the Entities which match the filter by checking all the masks
+		// in one pass, split between threads for the large Worlds
+		void matchAllEntities(detail::ComponentFilter const &filter, std::pmr::vector<Entity::Id> &matches);
+
 		// Checks the requirements the Entity meets for each Systems
 		// Used by actionEnable and actionRefresh
 		AttachStatus tryAttach(System &system, detail::TypeId systemId, Entity::Id id);
@@ -173,24 +356,55 @@ namespace ecs
 		// Extend the Entity and Component arrays
 		void extend(std::size_t size);
 
+		// Detach all Entities from the Systems and remove them at once,
+		// without processing pending actions
+		// The modified Entities are forgotten, so the states saved before
+		// cannot be used as delta baselines anymore
+		void resetEntities();
+
 		// List of all Entities
-		std::vector<EntityAttributes> m_entities;
+		std::pmr::vector<EntityAttributes> m_entities;
 
 		// List of Entities that have been modified
-		std::vector<EntityAction> m_actions;
+		std::pmr::vector<EntityAction> m_actions;
+
+		// Memory of the actions processed by the last update, reused for the next one
+		std::pmr::vector<EntityAction> m_processedActions;
+
+		// Identifier of the World, recorded by the saved states
+		detail::InstanceId m_instanceId;
 
-		// List of all Entity names, associated to their Entities, for
-		// faster search
-		std::unordered_map<std::string, Entity::Id> m_names;
+		// Version of the World, incremented each time the World is saved
+		// so that the modifications made afterwards can be told apart
+		mutable std::uint64_t m_version{ 1 };
+
+		// Version of the World when its Entities have been reset
+		// The states saved before cannot be the baseline of a delta anymore
+		std::uint64_t m_resetVersion{ 0 };
+
+		// Modified Entities, sorted by version
+		// Only the last modification of an Entity is relevant
+		std::pmr::vector<EntityChange> m_changes;
+
+		// Names of the Entities
+		detail::NameTable m_names;
 
 		// List of all Components of all Entities of the World
 		detail::ComponentHolder m_components;
 
+		// Report of the errors caught during the updates
+		// Its address does not change when the World is moved
+		std::unique_ptr<ErrorReport> m_errorReport;
+
 		// List of all Systems of the World
 		detail::SystemHolder m_systems;
 
-		// List of all System waiting to be started
-		std::vector<detail::Reference<System>> m_newSystems;
+		// Queries requested from the World
+		// Their address does not change when new Queries are added
+		std::pmr::vector<std::unique_ptr<Query>> m_queries;
+
+		// List of all System waiting to be started, with their type ID
+		std::pmr::vector<std::pair<detail::Reference<System>, detail::TypeId>> m_newSystems;
 
 		// ID Pool
 		detail::EntityPool m_pool;
@@ -198,10 +412,45 @@ namespace ecs
 		// Event Dispacher
 		EventDispatcher m_evtDispatcher;
 
+		// Memory of the temporary allocations of the current frame
+		// Its address does not change when the World is moved
+		std::unique_ptr<detail::FrameArena> m_frameArena;
+
+		// Number of threads matching the Entities against a new System, 0 for
+		// one per hardware thread
+		std::size_t m_attachThreadCount{ 1 };
+
+		// Measures of the updates
+		Profiler m_profiler;
+
+		// Structural changes of the current frame
+		FrameStats m_frameStats;
+
+		// Structural changes of the last frame
+		FrameStats m_lastFrameStats;
+
 		// Only Entity is able to use the detail::ComponentHolder
 		friend class Entity;
 
 		// Only System is able to use the EventDispatcher
 		friend class System;
+
+		// Snapshots access the Entities and Components storage directly
+		friend class SnapshotWriter;
+		friend class SnapshotReader;
+
+		// WorldState stores the Entities attributes
+		friend class WorldState;
+
+		// Deltas access the modified Entities directly
+		friend class DeltaWriter;
+		friend class DeltaReader;
+
+		// Mapped files provide the Components storage directly
+		friend class MappedStorage;
+
+		// Groups order the Components storage
+		template <class... Ts>
+		friend class Group;
 	};
 }
@@ -4,6 +4,8 @@
 #pragma once
 
 #include <memory>
+#include <type_traits>
+#include <typeinfo>
 #include <utility>
 
 #include <ECS/World.hpp>
@@ -11,9 +13,14 @@
 template <class T, class... Args>
 T &ecs::World::addSystem(std::size_t priority, Args &&...args)
 {
-	m_systems.addSystem<T>(priority, std::make_unique<T>(std::forward<Args>(args)...));
+	auto system{ std::make_unique<T>(std::forward<Args>(args)...) };
 
-	m_newSystems.emplace_back(getSystem<T>());
+	system->setMemoryResource(getMemoryResource());
+
+	m_systems.addSystem<T>(priority, std::move(system));
+
+	m_newSystems.emplace_back(getSystem<T>(), getSystemTypeId<T>());
+	m_profiler.addSystem(getSystemTypeId<T>(), typeid(T).name());
 
 	// Set System's World
 	getSystem<T>().m_world = *this;
@@ -48,7 +55,26 @@ void ecs::World::removeSystem()
 template <class Func>
 void ecs::World::updateSystems(Func &&func)
 {
-	updateEntities();
+	m_profiler.measure(Profiler::Step::UpdateEntities, m_actions.size(), [this]
+	{
+		updateEntities();
+	});
 
 	m_systems.forEach(std::forward<Func>(func));
 }
+
+template <class... Terms>
+ecs::Query &ecs::World::query()
+{
+	static_assert((detail::FilterTraits<detail::AsFilterTerm<Terms>>::isTerm && ...), "Terms must be Components, Require, Exclude, AnyOf or Optional.");
+
+	return query(detail::makeFilter<detail::AsFilterTerm<Terms>...>());
+}
+
+template <class T, class Compare>
+void ecs::World::sort(Compare &&compare, SortMode mode)
+{
+	static_assert(std::is_base_of<Component, T>::value, "T must be a Component.");
+
+	m_components.sortComponents<T>(std::forward<Compare>(compare), mode);
+}
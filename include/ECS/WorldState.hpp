@@ -0,0 +1,81 @@
+// Copyright (c) 2021 Ethan Margaillan <contact@ethan.jp>.
+// Licensed under the MIT License - https://raw.githubusercontent.com/Ethan13310/ECS/master/LICENSE
+
+#pragma once
+
+#include <cstdint>
+#include <memory_resource>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <ECS/Detail/ComponentHolder.hpp>
+#include <ECS/Detail/NameTable.hpp>
+#include <ECS/Detail/TypeInfo.hpp>
+#include <ECS/Entity.hpp>
+#include <ECS/System.hpp>
+#include <ECS/World.hpp>
+
+namespace ecs
+{
+	// In-memory copy of the state of a World, used to roll a World back
+	// A state is meant to be reused: saving a World into a state which already
+	// holds a previous save of the same World reuses its memory
+	class WorldState
+	{
+	public:
+		WorldState() = default;
+		~WorldState() = default;
+
+		WorldState(WorldState const &) = delete;
+		WorldState(WorldState &&) = default;
+
+		WorldState &operator=(WorldState const &) = delete;
+		WorldState &operator=(WorldState &&) = default;
+
+		// Check whether a World has been saved into the state
+		bool isEmpty() const noexcept;
+
+		// Remove the saved World and release the memory
+		void clear();
+
+	private:
+		// Identifier of the World which has been saved, 0 if none
+		// Unlike its address, it cannot be shared with another World created
+		// after the saved one has been destroyed
+		std::uint64_t m_worldId{ 0 };
+
+		// Version of the World when it has been saved
+		std::uint64_t m_version{ 0 };
+
+		// Saved modified Entities
+		std::pmr::vector<World::EntityChange> m_changes;
+
+		// Saved Entities attributes
+		std::pmr::vector<World::EntityAttributes> m_entities;
+
+		// Saved pending actions
+		std::pmr::vector<World::EntityAction> m_actions;
+
+		// Saved Entity names
+		detail::NameTable m_names;
+
+		// Saved Components
+		detail::ComponentHolder m_components;
+
+		// Saved free Entity IDs
+		std::vector<Entity::Id> m_storedIds;
+
+		// Saved next Entity ID
+		Entity::Id m_nextId{ 0 };
+
+		// Saved Entities of each System
+		std::unordered_map<detail::TypeId, System::State> m_systems;
+
+		// Only World can save and restore its state
+		friend class World;
+
+		// A state is the baseline of a delta
+		friend class DeltaWriter;
+	};
+}
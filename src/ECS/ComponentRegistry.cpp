@@ -0,0 +1,49 @@
+// Copyright (c) 2021 Ethan Margaillan <contact@ethan.jp>.
+// Licensed under the MIT License - https://raw.githubusercontent.com/Ethan13310/ECS/master/LICENSE
+
+#include <ECS/ComponentRegistry.hpp>
+#include <ECS/Exceptions/Exception.hpp>
+
+std::optional<ecs::ComponentRegistry::StableId> ecs::ComponentRegistry::getStableId(detail::TypeId typeId) const
+{
+	auto const it{ m_stableIds.find(typeId) };
+
+	if (it == m_stableIds.end())
+	{
+		return std::nullopt;
+	}
+
+	return it->second;
+}
+
+ecs::detail::ComponentInfo const *ecs::ComponentRegistry::getInfo(StableId id) const
+{
+	auto const it{ m_components.find(id) };
+
+	if (it == m_components.end())
+	{
+		return nullptr;
+	}
+
+	return &it->second;
+}
+
+void ecs::ComponentRegistry::registerInfo(detail::ComponentInfo const &info, StableId id)
+{
+	auto const component{ m_components.find(id) };
+
+	if (component != m_components.end() && component->second.typeId != info.typeId)
+	{
+		throw Exception{ "Stable ID already used by another Component.", "ecs::ComponentRegistry::registerComponent()" };
+	}
+
+	auto const stableId{ m_stableIds.find(info.typeId) };
+
+	if (stableId != m_stableIds.end() && stableId->second != id)
+	{
+		throw Exception{ "Component already registered with another stable ID.", "ecs::ComponentRegistry::registerComponent()" };
+	}
+
+	m_components[id] = info;
+	m_stableIds[info.typeId] = id;
+}
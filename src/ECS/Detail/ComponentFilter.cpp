@@ -6,12 +6,21 @@
 void ecs::detail::ComponentFilter::excludeAll() noexcept
 {
 	m_required.reset();
+	m_anyOf.clear();
+	m_optional.reset();
 	m_excluded.set();
 }
 
 void ecs::detail::ComponentFilter::excludeNotRequired() noexcept
 {
-	m_excluded = ~m_required;
+	auto accepted{ m_required | m_optional };
+
+	for (auto const &group : m_anyOf)
+	{
+		accepted |= group;
+	}
+
+	m_excluded = ~accepted;
 }
 
 bool ecs::detail::ComponentFilter::check(Mask const &mask) const
@@ -24,14 +33,73 @@ bool ecs::detail::ComponentFilter::check(Mask const &mask) const
 		return false;
 	}
 
-	for (std::size_t i{ 0 }; i < m_required.size(); ++i)
+	// Check if a required component is missing
+	if ((m_required & mask) != m_required)
 	{
-		if (m_required[i] && !mask[i]) 
+		return false;
+	}
+
+	// Check if none of the components of a group is present
+	for (auto const &group : m_anyOf)
+	{
+		if ((group & mask).none())
 		{
-			// A required component is missing
 			return false;
 		}
 	}
 
 	return true;
 }
+
+void ecs::detail::ComponentFilter::checkAll(Mask const *masks, std::size_t count, std::uint8_t *matches) const noexcept
+{
+	static_assert(MAX_COMPONENTS <= 64, "The masks must fit in a word.");
+
+	auto const required{ m_required.to_ullong() };
+	auto const excluded{ m_excluded.to_ullong() };
+
+	// Without any-of groups, the loop has no branch and can be vectorized
+	for (std::size_t i{ 0 }; i < count; ++i)
+	{
+		auto const mask{ masks[i].to_ullong() };
+		matches[i] = static_cast<std::uint8_t>((mask & required) == required && (mask & excluded) == 0);
+	}
+
+	for (auto const &group : m_anyOf)
+	{
+		auto const anyOf{ group.to_ullong() };
+
+		for (std::size_t i{ 0 }; i < count; ++i)
+		{
+			matches[i] &= static_cast<std::uint8_t>((masks[i].to_ullong() & anyOf) != 0);
+		}
+	}
+}
+
+bool ecs::detail::ComponentFilter::operator==(ComponentFilter const &other) const noexcept
+{
+	return m_required == other.m_required
+		&& m_excluded == other.m_excluded
+		&& m_optional == other.m_optional
+		&& m_anyOf == other.m_anyOf;
+}
+
+ecs::detail::ComponentFilter::Mask const &ecs::detail::ComponentFilter::getRequired() const noexcept
+{
+	return m_required;
+}
+
+ecs::detail::ComponentFilter::Mask const &ecs::detail::ComponentFilter::getExcluded() const noexcept
+{
+	return m_excluded;
+}
+
+std::vector<ecs::detail::ComponentFilter::Mask> const &ecs::detail::ComponentFilter::getAnyOf() const noexcept
+{
+	return m_anyOf;
+}
+
+ecs::detail::ComponentFilter::Mask const &ecs::detail::ComponentFilter::getOptional() const noexcept
+{
+	return m_optional;
+}
@@ -2,16 +2,44 @@
 // Licensed under the MIT License - https://raw.githubusercontent.com/Ethan13310/ECS/master/LICENSE
 
 #include <ECS/Detail/ComponentHolder.hpp>
+#include <ECS/Detail/MemoryUsage.hpp>
+#include <ECS/Exceptions/Exception.hpp>
+
+ecs::detail::ComponentHolder::ComponentHolder(std::pmr::memory_resource *resource) :
+	m_componentsMasks{ resource },
+	m_entitySets(MAX_COMPONENTS, resource),
+	m_groups{ resource }
+{
+	m_typeGroups.fill(ComponentPool::npos);
+}
 
 void ecs::detail::ComponentHolder::removeAllComponents(Entity::Id id)
 {
-	if (id < m_components.size())
+	if (id < m_componentsMasks.size())
 	{
-		for (auto &component : m_components[id])
+		refreshGroups();
+
+		for (auto &group : m_groups)
+		{
+			leaveGroup(group, id);
+		}
+
+		for (auto &pool : m_pools)
+		{
+			if (pool != nullptr)
+			{
+				pool->remove(id);
+			}
+		}
+
+		for (TypeId typeId{ 0 }; typeId < MAX_COMPONENTS; ++typeId)
 		{
-			component.reset();
+			if (m_componentsMasks[id].test(typeId))
+			{
+				m_entitySets[typeId].reset(id);
+			}
 		}
-		
+
 		m_componentsMasks[id].reset();
 	}
 }
@@ -27,14 +55,332 @@ ecs::detail::ComponentFilter::Mask ecs::detail::ComponentHolder::getComponentsMa
 	return {};
 }
 
+std::pmr::vector<ecs::detail::ComponentFilter::Mask> const &ecs::detail::ComponentHolder::getComponentsMasks() const noexcept
+{
+	return m_componentsMasks;
+}
+
+ecs::detail::EntityBitset const &ecs::detail::ComponentHolder::getEntities(TypeId typeId) const noexcept
+{
+	return m_entitySets[typeId];
+}
+
+std::size_t ecs::detail::ComponentHolder::addGroup(ComponentFilter::Mask const &owned)
+{
+	if (owned.none())
+	{
+		throw Exception{ "Group does not own any Component.", "ecs::detail::ComponentHolder::addGroup()" };
+	}
+
+	for (std::size_t index{ 0 }; index < m_groups.size(); ++index)
+	{
+		if (m_groups[index].owned == owned)
+		{
+			return index;
+		}
+
+		if ((m_groups[index].owned & owned).any())
+		{
+			throw Exception{ "Component is already owned by another group.", "ecs::detail::ComponentHolder::addGroup()" };
+		}
+	}
+
+	for (TypeId typeId{ 0 }; typeId < MAX_COMPONENTS; ++typeId)
+	{
+		if (owned.test(typeId) && m_pools[typeId] != nullptr && m_pools[typeId]->getInfo().relocate == nullptr)
+		{
+			throw Exception{ "Component is not relocatable.", "ecs::detail::ComponentHolder::addGroup()" };
+		}
+	}
+
+	m_groups.push_back({ owned, 0 });
+
+	for (TypeId typeId{ 0 }; typeId < MAX_COMPONENTS; ++typeId)
+	{
+		if (owned.test(typeId))
+		{
+			m_typeGroups[typeId] = m_groups.size() - 1;
+		}
+	}
+
+	// Gather the Entities which already have the owned Components
+	refreshGroups();
+
+	for (Entity::Id id{ 0 }; id < m_componentsMasks.size(); ++id)
+	{
+		enterGroup(m_groups.back(), id);
+	}
+
+	return m_groups.size() - 1;
+}
+
+std::size_t ecs::detail::ComponentHolder::getGroupSize(std::size_t group)
+{
+	refreshGroups();
+
+	return m_groups[group].size;
+}
+
+ecs::detail::ComponentPool *ecs::detail::ComponentHolder::getPool(TypeId typeId) noexcept
+{
+	if (typeId < m_pools.size())
+	{
+		return m_pools[typeId].get();
+	}
+
+	return nullptr;
+}
+
+ecs::detail::ComponentPool const *ecs::detail::ComponentHolder::getPool(TypeId typeId) const noexcept
+{
+	if (typeId < m_pools.size())
+	{
+		return m_pools[typeId].get();
+	}
+
+	return nullptr;
+}
+
+ecs::detail::ComponentPool &ecs::detail::ComponentHolder::getOrCreatePool(ComponentInfo const &info)
+{
+	if (info.typeId >= m_pools.size())
+	{
+		// The Component type ID is out of range
+		throw InvalidComponent{ "ecs::detail::ComponentHolder::getOrCreatePool()" };
+	}
+
+	auto &pool{ m_pools[info.typeId] };
+
+	if (pool == nullptr)
+	{
+		pool = std::make_unique<ComponentPool>(info, m_componentsMasks.get_allocator().resource());
+	}
+
+	return *pool;
+}
+
+void ecs::detail::ComponentHolder::setComponentsMask(Entity::Id id, ComponentFilter::Mask const &mask)
+{
+	if (id >= m_componentsMasks.size())
+	{
+		throw InvalidEntity{ "ecs::detail::ComponentHolder::setComponentsMask()" };
+	}
+
+	auto const changed{ m_componentsMasks[id] ^ mask };
+
+	for (TypeId typeId{ 0 }; typeId < MAX_COMPONENTS; ++typeId)
+	{
+		if (!changed.test(typeId))
+		{
+			continue;
+		}
+
+		if (mask.test(typeId))
+		{
+			m_entitySets[typeId].set(id);
+		}
+		else
+		{
+			m_entitySets[typeId].reset(id);
+		}
+	}
+
+	m_componentsMasks[id] = mask;
+
+	// The Components have been written into the pools directly
+	m_groupsDirty = !m_groups.empty();
+}
+
+std::size_t ecs::detail::ComponentHolder::size() const noexcept
+{
+	return m_componentsMasks.size();
+}
+
 void ecs::detail::ComponentHolder::resize(std::size_t size)
 {
-	m_components.resize(size);
+	// Destroy the Components of the Entities which are about to be removed
+	for (auto id{ size }; id < m_componentsMasks.size(); ++id)
+	{
+		removeAllComponents(id);
+	}
+
 	m_componentsMasks.resize(size);
 }
 
+void ecs::detail::ComponentHolder::copyFrom(ComponentHolder const &other)
+{
+	if (&other == this)
+	{
+		return;
+	}
+
+	for (std::size_t typeId{ 0 }; typeId < m_pools.size(); ++typeId)
+	{
+		auto const &source{ other.m_pools[typeId] };
+
+		if (source != nullptr)
+		{
+			getOrCreatePool(source->getInfo()).copyFrom(*source);
+		}
+		else if (m_pools[typeId] != nullptr)
+		{
+			m_pools[typeId]->clear();
+		}
+	}
+
+	m_componentsMasks = other.m_componentsMasks;
+	m_entitySets = other.m_entitySets;
+
+	// The slots of the other holder do not follow the groups
+	m_groupsDirty = !m_groups.empty();
+}
+
 void ecs::detail::ComponentHolder::clear() noexcept
 {
-	m_components.clear();
+	for (auto &pool : m_pools)
+	{
+		pool.reset();
+	}
+
 	m_componentsMasks.clear();
+
+	for (auto &set : m_entitySets)
+	{
+		set.clear();
+	}
+
+	// The groups are kept, but they are empty
+	for (auto &group : m_groups)
+	{
+		group.size = 0;
+	}
+
+	m_groupsDirty = false;
+}
+
+void ecs::detail::ComponentHolder::shrinkToFit(std::size_t size)
+{
+	resize(size);
+	m_componentsMasks.shrink_to_fit();
+
+	for (auto &set : m_entitySets)
+	{
+		set.shrinkToFit(size);
+	}
+
+	for (auto &pool : m_pools)
+	{
+		if (pool == nullptr)
+		{
+			continue;
+		}
+
+		if (pool->size() == 0)
+		{
+			pool.reset();
+		}
+		else
+		{
+			pool->shrinkToFit();
+		}
+	}
+}
+
+ecs::MemoryUsage ecs::detail::ComponentHolder::getMasksMemoryUsage() const noexcept
+{
+	auto memory{ detail::getMemoryUsage(m_componentsMasks) };
+	memory += detail::getMemoryUsage(m_groups);
+
+	for (auto const &set : m_entitySets)
+	{
+		memory += set.getMemoryUsage();
+	}
+
+	return memory;
+}
+
+void ecs::detail::ComponentHolder::enterGroup(OwningGroup &group, Entity::Id id)
+{
+	if ((m_componentsMasks[id] & group.owned) != group.owned)
+	{
+		return;
+	}
+
+	// The first size slots of the pools hold the Entities of the group
+	for (TypeId typeId{ 0 }; typeId < MAX_COMPONENTS; ++typeId)
+	{
+		if (group.owned.test(typeId))
+		{
+			if (m_pools[typeId]->getSlot(id) < group.size)
+			{
+				return;
+			}
+
+			break;
+		}
+	}
+
+	for (TypeId typeId{ 0 }; typeId < MAX_COMPONENTS; ++typeId)
+	{
+		if (group.owned.test(typeId))
+		{
+			m_pools[typeId]->moveToSlot(id, group.size);
+		}
+	}
+
+	++group.size;
+}
+
+void ecs::detail::ComponentHolder::leaveGroup(OwningGroup &group, Entity::Id id)
+{
+	if (group.size == 0 || (m_componentsMasks[id] & group.owned) != group.owned)
+	{
+		return;
+	}
+
+	for (TypeId typeId{ 0 }; typeId < MAX_COMPONENTS; ++typeId)
+	{
+		if (group.owned.test(typeId))
+		{
+			if (m_pools[typeId]->getSlot(id) >= group.size)
+			{
+				return;
+			}
+
+			break;
+		}
+	}
+
+	// The last Entity of the group takes the place of the leaving one
+	for (TypeId typeId{ 0 }; typeId < MAX_COMPONENTS; ++typeId)
+	{
+		if (group.owned.test(typeId))
+		{
+			m_pools[typeId]->moveToSlot(id, group.size - 1);
+		}
+	}
+
+	--group.size;
+}
+
+void ecs::detail::ComponentHolder::refreshGroups()
+{
+	if (!m_groupsDirty)
+	{
+		return;
+	}
+
+	m_groupsDirty = false;
+
+	// Each Entity which enters a group takes the slot right after the group,
+	// so the slots of the group only ever hold Entities which entered it
+	for (auto &group : m_groups)
+	{
+		group.size = 0;
+
+		for (Entity::Id id{ 0 }; id < m_componentsMasks.size(); ++id)
+		{
+			enterGroup(group, id);
+		}
+	}
 }
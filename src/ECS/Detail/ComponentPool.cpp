@@ -0,0 +1,484 @@
+// Copyright (c) 2021 Ethan Margaillan <contact@ethan.jp>.
+// Licensed under the MIT License - https://raw.githubusercontent.com/Ethan13310/ECS/master/LICENSE
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <new>
+#include <utility>
+
+#include <ECS/Detail/ComponentPool.hpp>
+#include <ECS/Detail/MemoryUsage.hpp>
+#include <ECS/Exceptions/Exception.hpp>
+#include <ECS/Exceptions/InvalidComponent.hpp>
+
+ecs::detail::ComponentPool::ComponentPool(ComponentInfo const &info, std::pmr::memory_resource *resource) :
+	m_info{ info },
+	m_pageSlots{ std::max<std::size_t>(1, PAGE_SIZE / info.size) },
+	m_pageAlignment{ std::max(PAGE_ALIGNMENT, info.alignment) },
+	// Braces would make a page of the resource address
+	m_pages(resource),
+	m_slots{ resource },
+	m_owners{ resource },
+	m_freeSlots{ resource }
+{}
+
+ecs::detail::ComponentPool::~ComponentPool()
+{
+	clear();
+}
+
+void *ecs::detail::ComponentPool::assign(Entity::Id id)
+{
+	auto const slot{ acquireSlot(id) };
+
+	bind(id, slot);
+
+	return address(slot);
+}
+
+bool ecs::detail::ComponentPool::has(Entity::Id id) const noexcept
+{
+	return id < m_slots.size() && m_slots[id] != npos;
+}
+
+void *ecs::detail::ComponentPool::get(Entity::Id id) noexcept
+{
+	if (!has(id))
+	{
+		return nullptr;
+	}
+
+	return address(m_slots[id]);
+}
+
+void const *ecs::detail::ComponentPool::get(Entity::Id id) const noexcept
+{
+	if (!has(id))
+	{
+		return nullptr;
+	}
+
+	return address(m_slots[id]);
+}
+
+void ecs::detail::ComponentPool::remove(Entity::Id id) noexcept
+{
+	if (has(id))
+	{
+		auto const slot{ m_slots[id] };
+
+		m_info.destroy(address(slot));
+		m_slots[id] = npos;
+		m_owners[slot] = npos;
+		--m_size;
+
+		releaseSlot(slot);
+	}
+}
+
+void ecs::detail::ComponentPool::clear() noexcept
+{
+	destroyAll();
+
+	for (auto page{ m_pages.begin() + static_cast<std::ptrdiff_t>(m_externalPages) }; page != m_pages.end(); ++page)
+	{
+		m_pages.get_allocator().resource()->deallocate(*page, m_pageSlots * m_info.size, m_pageAlignment);
+	}
+
+	m_pages.clear();
+	m_externalPages = 0;
+	m_storage.reset();
+
+	if (m_scratch != nullptr)
+	{
+		m_pages.get_allocator().resource()->deallocate(m_scratch, m_info.size, m_info.alignment);
+		m_scratch = nullptr;
+	}
+}
+
+void ecs::detail::ComponentPool::reserve(std::size_t count)
+{
+	while (m_pages.size() * m_pageSlots < count)
+	{
+		m_pages.push_back(m_pages.get_allocator().resource()->allocate(m_pageSlots * m_info.size, m_pageAlignment));
+	}
+}
+
+void ecs::detail::ComponentPool::shrinkToFit()
+{
+	while (!m_owners.empty() && m_owners.back() == npos)
+	{
+		m_owners.pop_back();
+	}
+
+	while (!m_slots.empty() && m_slots.back() == npos)
+	{
+		m_slots.pop_back();
+	}
+
+	// Owned pages which are past the last used slot
+	auto const pageCount{ std::max((m_owners.size() + m_pageSlots - 1) / m_pageSlots, m_externalPages) };
+
+	for (auto page{ pageCount }; page < m_pages.size(); ++page)
+	{
+		m_pages.get_allocator().resource()->deallocate(m_pages[page], m_pageSlots * m_info.size, m_pageAlignment);
+	}
+
+	m_pages.resize(pageCount);
+	m_pages.shrink_to_fit();
+
+	m_slots.shrink_to_fit();
+	m_owners.shrink_to_fit();
+
+	// Free slots which have been trimmed
+	decltype(m_freeSlots) freeSlots{ m_freeSlots.get_allocator() };
+
+	// Make sure releasing a slot will never allocate
+	freeSlots.reserve(m_owners.size());
+
+	for (auto const slot : m_freeSlots)
+	{
+		if (slot < m_owners.size())
+		{
+			freeSlots.push_back(slot);
+		}
+	}
+
+	m_freeSlots.swap(freeSlots);
+}
+
+void ecs::detail::ComponentPool::adopt(void *data, std::vector<Entity::Id> owners, std::shared_ptr<void> storage)
+{
+	if (!m_pages.empty())
+	{
+		throw Exception{ "Pool is not empty.", "ecs::detail::ComponentPool::adopt()" };
+	}
+
+	if (reinterpret_cast<std::uintptr_t>(data) % m_info.alignment != 0)
+	{
+		throw Exception{ "Storage is not aligned for the Component.", "ecs::detail::ComponentPool::adopt()" };
+	}
+
+	auto const pageCount{ (owners.size() + m_pageSlots - 1) / m_pageSlots };
+
+	m_pages.reserve(pageCount);
+
+	for (std::size_t page{ 0 }; page < pageCount; ++page)
+	{
+		m_pages.push_back(static_cast<unsigned char*>(data) + page * m_pageSlots * m_info.size);
+	}
+
+	m_externalPages = pageCount;
+	m_storage = std::move(storage);
+
+	for (std::size_t slot{ 0 }; slot < owners.size(); ++slot)
+	{
+		if (owners[slot] >= m_slots.size())
+		{
+			m_slots.resize(owners[slot] + 1, npos);
+		}
+
+		m_slots[owners[slot]] = slot;
+	}
+
+	m_size = owners.size();
+	m_owners.assign(owners.begin(), owners.end());
+
+	// Make sure releasing a slot will never allocate
+	m_freeSlots.reserve(m_owners.size());
+}
+
+void ecs::detail::ComponentPool::copyFrom(ComponentPool const &other)
+{
+	if (&other == this)
+	{
+		return;
+	}
+
+	if (other.m_info.typeId != m_info.typeId)
+	{
+		throw InvalidComponent{ "ecs::detail::ComponentPool::copyFrom()" };
+	}
+
+	if (!m_info.triviallyCopyable && m_info.copy == nullptr)
+	{
+		throw Exception{ "Component is not copyable.", "ecs::detail::ComponentPool::copyFrom()" };
+	}
+
+	destroyAll();
+	reserve(other.m_owners.size());
+
+	if (m_info.triviallyCopyable)
+	{
+		// Copy the used part of each page at once
+		for (std::size_t first{ 0 }; first < other.m_owners.size(); first += m_pageSlots)
+		{
+			auto const count{ std::min(m_pageSlots, other.m_owners.size() - first) };
+
+			std::memcpy(address(first), other.address(first), count * m_info.size);
+		}
+
+		m_slots = other.m_slots;
+		m_owners = other.m_owners;
+		m_size = other.m_size;
+	}
+	else
+	{
+		m_slots.assign(other.m_slots.size(), npos);
+		m_owners.assign(other.m_owners.size(), npos);
+
+		for (std::size_t slot{ 0 }; slot < other.m_owners.size(); ++slot)
+		{
+			auto const id{ other.m_owners[slot] };
+
+			if (id != npos)
+			{
+				m_info.copy(address(slot), other.address(slot));
+
+				m_slots[id] = slot;
+				m_owners[slot] = id;
+				++m_size;
+			}
+		}
+	}
+
+	// Make sure releasing a slot will never allocate
+	m_freeSlots.reserve(m_owners.size());
+	m_freeSlots = other.m_freeSlots;
+}
+
+void ecs::detail::ComponentPool::moveToSlot(Entity::Id id, std::size_t slot)
+{
+	if (!has(id) || slot >= m_owners.size())
+	{
+		throw Exception{ "Invalid slot.", "ecs::detail::ComponentPool::moveToSlot()" };
+	}
+
+	auto const from{ m_slots[id] };
+
+	if (from == slot)
+	{
+		return;
+	}
+
+	if (m_info.relocate == nullptr)
+	{
+		throw Exception{ "Component is not relocatable.", "ecs::detail::ComponentPool::moveToSlot()" };
+	}
+
+	if (m_owners[slot] == npos)
+	{
+		// The target slot is not free anymore, but the previous one is
+		*std::find(m_freeSlots.begin(), m_freeSlots.end(), slot) = from;
+	}
+
+	relocate(id, slot);
+}
+
+void ecs::detail::ComponentPool::permute(std::pmr::vector<Entity::Id> const &order)
+{
+	if (order.size() > m_size)
+	{
+		throw Exception{ "Invalid order.", "ecs::detail::ComponentPool::permute()" };
+	}
+
+	if (m_info.relocate == nullptr)
+	{
+		throw Exception{ "Component is not relocatable.", "ecs::detail::ComponentPool::permute()" };
+	}
+
+	for (auto const id : order)
+	{
+		if (!has(id))
+		{
+			throw Exception{ "Invalid order.", "ecs::detail::ComponentPool::permute()" };
+		}
+	}
+
+	for (std::size_t slot{ 0 }; slot < order.size(); ++slot)
+	{
+		relocate(order[slot], slot);
+	}
+
+	// The free slots have moved, the lowest ones are given first
+	m_freeSlots.clear();
+
+	for (auto slot{ m_owners.size() }; slot > 0; --slot)
+	{
+		if (m_owners[slot - 1] == npos)
+		{
+			m_freeSlots.push_back(slot - 1);
+		}
+	}
+}
+
+std::size_t ecs::detail::ComponentPool::getSlot(Entity::Id id) const noexcept
+{
+	return has(id) ? m_slots[id] : npos;
+}
+
+ecs::Entity::Id ecs::detail::ComponentPool::getOwner(std::size_t slot) const noexcept
+{
+	return slot < m_owners.size() ? m_owners[slot] : npos;
+}
+
+void *ecs::detail::ComponentPool::getSlotAddress(std::size_t slot) noexcept
+{
+	return address(slot);
+}
+
+std::size_t ecs::detail::ComponentPool::size() const noexcept
+{
+	return m_size;
+}
+
+ecs::detail::ComponentInfo const &ecs::detail::ComponentPool::getInfo() const noexcept
+{
+	return m_info;
+}
+
+std::size_t ecs::detail::ComponentPool::getPageSlots() const noexcept
+{
+	return m_pageSlots;
+}
+
+std::size_t ecs::detail::ComponentPool::getPageAlignment() const noexcept
+{
+	return m_pageAlignment;
+}
+
+ecs::MemoryUsage ecs::detail::ComponentPool::getMemoryUsage() const noexcept
+{
+	MemoryUsage memory;
+
+	memory.used = m_size * m_info.size;
+	memory.reserved = (m_pages.size() - m_externalPages) * m_pageSlots * m_info.size;
+
+	if (m_externalPages > 0)
+	{
+		// Only the Components stored into the pages owned by the pool are counted
+		auto const first{ std::min(m_externalPages * m_pageSlots, m_owners.size()) };
+		auto const count{ std::count_if(m_owners.begin() + static_cast<std::ptrdiff_t>(first), m_owners.end(), [](Entity::Id owner)
+		{
+			return owner != npos;
+		}) };
+
+		memory.used = static_cast<std::size_t>(count) * m_info.size;
+	}
+
+	memory += detail::getMemoryUsage(m_pages);
+	memory += detail::getMemoryUsage(m_slots);
+	memory += detail::getMemoryUsage(m_owners);
+	memory += detail::getMemoryUsage(m_freeSlots);
+
+	if (m_scratch != nullptr)
+	{
+		memory.reserved += m_info.size;
+	}
+
+	return memory;
+}
+
+std::size_t ecs::detail::ComponentPool::acquireSlot(Entity::Id id)
+{
+	if (id >= m_slots.size())
+	{
+		m_slots.resize(id + 1, npos);
+	}
+
+	if (!m_freeSlots.empty())
+	{
+		auto const slot{ m_freeSlots.back() };
+		m_freeSlots.pop_back();
+
+		return slot;
+	}
+
+	auto const slot{ m_owners.size() };
+
+	// Allocate a new page if all the slots are used
+	reserve(slot + 1);
+
+	// Make sure releasing a slot will never allocate
+	if (m_freeSlots.capacity() <= slot)
+	{
+		m_freeSlots.reserve(std::max(slot + 1, m_freeSlots.capacity() * 2));
+	}
+
+	m_owners.push_back(npos);
+
+	return slot;
+}
+
+void ecs::detail::ComponentPool::releaseSlot(std::size_t slot) noexcept
+{
+	m_freeSlots.push_back(slot);
+}
+
+void ecs::detail::ComponentPool::bind(Entity::Id id, std::size_t slot) noexcept
+{
+	// Destroy the previous Component
+	remove(id);
+
+	m_slots[id] = slot;
+	m_owners[slot] = id;
+	++m_size;
+}
+
+void ecs::detail::ComponentPool::relocate(Entity::Id id, std::size_t slot)
+{
+	auto const from{ m_slots[id] };
+	auto const other{ m_owners[slot] };
+
+	if (from == slot)
+	{
+		return;
+	}
+
+	if (other == npos)
+	{
+		m_info.relocate(address(slot), address(from));
+	}
+	else
+	{
+		// Swap the Components through the scratch storage
+		if (m_scratch == nullptr)
+		{
+			m_scratch = m_pages.get_allocator().resource()->allocate(m_info.size, m_info.alignment);
+		}
+
+		m_info.relocate(m_scratch, address(slot));
+		m_info.relocate(address(slot), address(from));
+		m_info.relocate(address(from), m_scratch);
+
+		m_slots[other] = from;
+	}
+
+	m_owners[from] = other;
+	m_owners[slot] = id;
+	m_slots[id] = slot;
+}
+
+void ecs::detail::ComponentPool::destroyAll() noexcept
+{
+	for (std::size_t slot{ 0 }; slot < m_owners.size(); ++slot)
+	{
+		if (m_owners[slot] != npos)
+		{
+			m_info.destroy(address(slot));
+		}
+	}
+
+	m_slots.clear();
+	m_owners.clear();
+	m_freeSlots.clear();
+	m_size = 0;
+}
+
+void *ecs::detail::ComponentPool::address(std::size_t slot) const noexcept
+{
+	auto const page{ static_cast<unsigned char*>(m_pages[slot / m_pageSlots]) };
+
+	return page + (slot % m_pageSlots) * m_info.size;
+}
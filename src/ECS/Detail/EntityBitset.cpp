@@ -0,0 +1,139 @@
+// Copyright (c) 2021 Ethan Margaillan <contact@ethan.jp>.
+// Licensed under the MIT License - https://raw.githubusercontent.com/Ethan13310/ECS/master/LICENSE
+
+#include <utility>
+
+#include <ECS/Detail/EntityBitset.hpp>
+#include <ECS/Detail/MemoryUsage.hpp>
+
+ecs::detail::EntityBitset::EntityBitset(allocator_type const &allocator) :
+	m_words{ allocator },
+	m_summary{ allocator }
+{}
+
+ecs::detail::EntityBitset::EntityBitset(EntityBitset const &other, allocator_type const &allocator) :
+	m_words{ other.m_words, allocator },
+	m_summary{ other.m_summary, allocator }
+{}
+
+ecs::detail::EntityBitset::EntityBitset(EntityBitset &&other, allocator_type const &allocator) :
+	m_words{ std::move(other.m_words), allocator },
+	m_summary{ std::move(other.m_summary), allocator }
+{}
+
+void ecs::detail::EntityBitset::set(Entity::Id id)
+{
+	auto const word{ id / WORD_BITS };
+
+	if (word >= m_words.size())
+	{
+		m_words.resize(word + 1, 0);
+		m_summary.resize(word / WORD_BITS + 1, 0);
+	}
+
+	m_words[word] |= std::uint64_t{ 1 } << (id % WORD_BITS);
+	m_summary[word / WORD_BITS] |= std::uint64_t{ 1 } << (word % WORD_BITS);
+}
+
+void ecs::detail::EntityBitset::reset(Entity::Id id) noexcept
+{
+	auto const word{ id / WORD_BITS };
+
+	if (word >= m_words.size())
+	{
+		return;
+	}
+
+	m_words[word] &= ~(std::uint64_t{ 1 } << (id % WORD_BITS));
+
+	if (m_words[word] == 0)
+	{
+		m_summary[word / WORD_BITS] &= ~(std::uint64_t{ 1 } << (word % WORD_BITS));
+	}
+}
+
+bool ecs::detail::EntityBitset::test(Entity::Id id) const noexcept
+{
+	return (getWord(id / WORD_BITS) >> (id % WORD_BITS) & 1) != 0;
+}
+
+bool ecs::detail::EntityBitset::none() const noexcept
+{
+	for (auto const summary : m_summary)
+	{
+		if (summary != 0)
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+void ecs::detail::EntityBitset::clear() noexcept
+{
+	m_words.clear();
+	m_summary.clear();
+}
+
+void ecs::detail::EntityBitset::shrinkToFit(std::size_t size)
+{
+	auto words{ (size + WORD_BITS - 1) / WORD_BITS };
+
+	if (words <= m_words.size())
+	{
+		m_words.resize(words);
+
+		// The bits of the last word past size are cleared
+		if (size % WORD_BITS != 0)
+		{
+			m_words.back() &= (std::uint64_t{ 1 } << (size % WORD_BITS)) - 1;
+		}
+	}
+
+	// The trailing empty words are released
+	words = m_words.size();
+
+	while (words > 0 && m_words[words - 1] == 0)
+	{
+		--words;
+	}
+
+	m_words.resize(words);
+	m_words.shrink_to_fit();
+
+	m_summary.assign((words + WORD_BITS - 1) / WORD_BITS, 0);
+	m_summary.shrink_to_fit();
+
+	for (std::size_t word{ 0 }; word < words; ++word)
+	{
+		if (m_words[word] != 0)
+		{
+			m_summary[word / WORD_BITS] |= std::uint64_t{ 1 } << (word % WORD_BITS);
+		}
+	}
+}
+
+std::uint64_t ecs::detail::EntityBitset::getWord(std::size_t index) const noexcept
+{
+	return index < m_words.size() ? m_words[index] : 0;
+}
+
+std::uint64_t ecs::detail::EntityBitset::getSummary(std::size_t index) const noexcept
+{
+	return index < m_summary.size() ? m_summary[index] : 0;
+}
+
+std::size_t ecs::detail::EntityBitset::getSummaryCount() const noexcept
+{
+	return m_summary.size();
+}
+
+ecs::MemoryUsage ecs::detail::EntityBitset::getMemoryUsage() const noexcept
+{
+	auto memory{ detail::getMemoryUsage(m_words) };
+
+	memory += detail::getMemoryUsage(m_summary);
+
+	return memory;
+}
@@ -1,7 +1,14 @@
 // Copyright (c) 2021 Ethan Margaillan <contact@ethan.jp>.
 // Licensed under the MIT License - https://raw.githubusercontent.com/Ethan13310/ECS/master/LICENSE
 
+#include <algorithm>
+
 #include <ECS/Detail/EntityPool.hpp>
+#include <ECS/Detail/MemoryUsage.hpp>
+
+ecs::detail::EntityPool::EntityPool(std::pmr::memory_resource *resource) :
+	m_storedIds{ resource }
+{}
 
 ecs::Entity::Id ecs::detail::EntityPool::create()
 {
@@ -30,8 +37,40 @@ void ecs::detail::EntityPool::store(Entity::Id id)
 	}
 }
 
+void ecs::detail::EntityPool::shrinkToFit(Entity::Id size)
+{
+	m_storedIds.erase(std::remove_if(m_storedIds.begin(), m_storedIds.end(), [&](Entity::Id id)
+	{
+		return id >= size;
+	}), m_storedIds.end());
+
+	m_storedIds.shrink_to_fit();
+	m_nextId = std::min(m_nextId, size);
+}
+
 void ecs::detail::EntityPool::reset() noexcept
 {
 	m_storedIds.clear();
 	m_nextId = 0;
 }
+
+std::pmr::vector<ecs::Entity::Id> const &ecs::detail::EntityPool::getStoredIds() const noexcept
+{
+	return m_storedIds;
+}
+
+ecs::Entity::Id ecs::detail::EntityPool::getNextId() const noexcept
+{
+	return m_nextId;
+}
+
+void ecs::detail::EntityPool::restore(Entity::Id nextId, std::vector<Entity::Id> const &storedIds)
+{
+	m_storedIds.assign(storedIds.begin(), storedIds.end());
+	m_nextId = nextId;
+}
+
+ecs::MemoryUsage ecs::detail::EntityPool::getMemoryUsage() const noexcept
+{
+	return detail::getMemoryUsage(m_storedIds);
+}
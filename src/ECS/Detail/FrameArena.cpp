@@ -0,0 +1,119 @@
+// Copyright (c) 2021 Ethan Margaillan <contact@ethan.jp>.
+// Licensed under the MIT License - https://raw.githubusercontent.com/Ethan13310/ECS/master/LICENSE
+
+#include <algorithm>
+#include <cstdint>
+
+#include <ECS/Detail/FrameArena.hpp>
+
+ecs::detail::FrameArena::FrameArena(std::pmr::memory_resource *upstream) :
+	m_blocks{ upstream }
+{}
+
+ecs::detail::FrameArena::~FrameArena()
+{
+	release();
+}
+
+void ecs::detail::FrameArena::reset()
+{
+	if (m_blocks.size() > 1)
+	{
+		std::size_t size{ 0 };
+
+		for (auto const &block : m_blocks)
+		{
+			size += block.size;
+		}
+
+		// A single block is enough for the next frames
+		release();
+		addBlock(size, alignof(std::max_align_t));
+	}
+
+	m_current = 0;
+	m_offset = 0;
+	m_used = 0;
+}
+
+void ecs::detail::FrameArena::release() noexcept
+{
+	auto const upstream{ m_blocks.get_allocator().resource() };
+
+	for (auto const &block : m_blocks)
+	{
+		upstream->deallocate(block.data, block.size, alignof(std::max_align_t));
+	}
+
+	m_blocks.clear();
+	m_current = 0;
+	m_offset = 0;
+	m_used = 0;
+}
+
+ecs::MemoryUsage ecs::detail::FrameArena::getMemoryUsage() const noexcept
+{
+	MemoryUsage memory{ m_used, 0 };
+
+	for (auto const &block : m_blocks)
+	{
+		memory.reserved += block.size;
+	}
+
+	return memory;
+}
+
+void *ecs::detail::FrameArena::do_allocate(std::size_t bytes, std::size_t alignment)
+{
+	while (m_current < m_blocks.size())
+	{
+		auto const &block{ m_blocks[m_current] };
+
+		auto const address{ reinterpret_cast<std::uintptr_t>(block.data) + m_offset };
+		auto const padding{ (alignment - address % alignment) % alignment };
+
+		if (m_offset + padding + bytes <= block.size)
+		{
+			m_offset += padding + bytes;
+			m_used += bytes;
+
+			return reinterpret_cast<void*>(address + padding);
+		}
+
+		// The rest of the block is left unused until the next reset
+		++m_current;
+		m_offset = 0;
+	}
+
+	addBlock(bytes, alignment);
+
+	return do_allocate(bytes, alignment);
+}
+
+void ecs::detail::FrameArena::do_deallocate(void *, std::size_t, std::size_t)
+{
+	// The memory is given back all at once by reset
+}
+
+bool ecs::detail::FrameArena::do_is_equal(std::pmr::memory_resource const &other) const noexcept
+{
+	return this == &other;
+}
+
+void ecs::detail::FrameArena::addBlock(std::size_t bytes, std::size_t alignment)
+{
+	// The blocks grow geometrically, so that a frame needs few of them
+	// The blocks are aligned on max_align_t, larger alignments may need padding
+	auto const padding{ alignment > alignof(std::max_align_t) ? alignment : 0 };
+	auto size{ std::max(BLOCK_SIZE, bytes + padding) };
+
+	if (!m_blocks.empty())
+	{
+		size = std::max(size, m_blocks.back().size * 2);
+	}
+
+	auto const upstream{ m_blocks.get_allocator().resource() };
+
+	m_blocks.reserve(m_blocks.size() + 1);
+	m_blocks.push_back(Block{ upstream->allocate(size, alignof(std::max_align_t)), size });
+}
@@ -0,0 +1,39 @@
+// Copyright (c) 2021 Ethan Margaillan <contact@ethan.jp>.
+// Licensed under the MIT License - https://raw.githubusercontent.com/Ethan13310/ECS/master/LICENSE
+
+#include <atomic>
+
+#include <ECS/Detail/InstanceId.hpp>
+
+ecs::detail::InstanceId::InstanceId() noexcept :
+	m_value{ next() }
+{}
+
+ecs::detail::InstanceId::InstanceId(InstanceId &&other) noexcept :
+	m_value{ other.m_value }
+{
+	other.m_value = next();
+}
+
+ecs::detail::InstanceId &ecs::detail::InstanceId::operator=(InstanceId &&other) noexcept
+{
+	if (&other != this)
+	{
+		m_value = other.m_value;
+		other.m_value = next();
+	}
+
+	return *this;
+}
+
+std::uint64_t ecs::detail::InstanceId::getValue() const noexcept
+{
+	return m_value;
+}
+
+std::uint64_t ecs::detail::InstanceId::next() noexcept
+{
+	static std::atomic<std::uint64_t> counter{ 1 };
+
+	return counter.fetch_add(1, std::memory_order_relaxed);
+}
@@ -0,0 +1,84 @@
+// Copyright (c) 2021 Ethan Margaillan <contact@ethan.jp>.
+// Licensed under the MIT License - https://raw.githubusercontent.com/Ethan13310/ECS/master/LICENSE
+
+#include <ECS/Detail/LogBuffer.hpp>
+
+ecs::detail::LogBuffer::LogBuffer(std::size_t capacity)
+{
+	std::size_t size{ 2 };
+
+	while (size < capacity)
+	{
+		size *= 2;
+	}
+
+	m_cells = std::make_unique<Cell[]>(size);
+	m_mask = size - 1;
+
+	for (std::size_t i{ 0 }; i < size; ++i)
+	{
+		m_cells[i].sequence.store(i, std::memory_order_relaxed);
+	}
+}
+
+bool ecs::detail::LogBuffer::push(std::size_t level, std::string_view message)
+{
+	auto position{ m_pushPosition.load(std::memory_order_relaxed) };
+	Cell *cell{ nullptr };
+
+	// Claim a cell
+	for (;;)
+	{
+		cell = &m_cells[position & m_mask];
+
+		auto const sequence{ cell->sequence.load(std::memory_order_acquire) };
+		auto const difference{ static_cast<std::ptrdiff_t>(sequence - position) };
+
+		if (difference == 0)
+		{
+			if (m_pushPosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+			{
+				break;
+			}
+		}
+		else if (difference < 0)
+		{
+			// The cell still holds a message from the previous lap
+			return false;
+		}
+		else
+		{
+			position = m_pushPosition.load(std::memory_order_relaxed);
+		}
+	}
+
+	cell->record.level = level;
+	cell->record.time = Clock::now();
+
+	try
+	{
+		cell->record.message.assign(message);
+	}
+	catch (...)
+	{
+		// The cell must be published anyway, so that the consumer is not stuck
+		cell->record.message.clear();
+	}
+
+	// Publish the message
+	cell->sequence.store(position + 1, std::memory_order_release);
+
+	return true;
+}
+
+bool ecs::detail::LogBuffer::empty() const noexcept
+{
+	auto const position{ m_popPosition.load(std::memory_order_relaxed) };
+
+	return m_cells[position & m_mask].sequence.load(std::memory_order_acquire) != position + 1;
+}
+
+std::size_t ecs::detail::LogBuffer::capacity() const noexcept
+{
+	return m_mask + 1;
+}
@@ -0,0 +1,116 @@
+// Copyright (c) 2021 Ethan Margaillan <contact@ethan.jp>.
+// Licensed under the MIT License - https://raw.githubusercontent.com/Ethan13310/ECS/master/LICENSE
+
+#ifdef _WIN32
+	// Win32 API
+	#include <windows.h>
+#else
+	// POSIX API
+	#include <fcntl.h>
+	#include <sys/mman.h>
+	#include <sys/stat.h>
+	#include <unistd.h>
+#endif
+
+#include <ECS/Detail/MappedFile.hpp>
+#include <ECS/Exceptions/Exception.hpp>
+
+ecs::detail::MappedFile::MappedFile(std::string const &path)
+{
+	#ifdef _WIN32
+
+	auto const file{ CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr) };
+
+	if (file == INVALID_HANDLE_VALUE)
+	{
+		throw Exception{ "Unable to open the file.", "ecs::detail::MappedFile::MappedFile()" };
+	}
+
+	LARGE_INTEGER size{};
+
+	if (!GetFileSizeEx(file, &size) || size.QuadPart == 0)
+	{
+		CloseHandle(file);
+		throw Exception{ "Unable to map an empty file.", "ecs::detail::MappedFile::MappedFile()" };
+	}
+
+	// Copy-on-write mapping
+	auto const mapping{ CreateFileMappingA(file, nullptr, PAGE_WRITECOPY, 0, 0, nullptr) };
+	auto const data{ mapping != nullptr ? MapViewOfFile(mapping, FILE_MAP_COPY, 0, 0, 0) : nullptr };
+
+	if (data == nullptr)
+	{
+		if (mapping != nullptr)
+		{
+			CloseHandle(mapping);
+		}
+
+		CloseHandle(file);
+		throw Exception{ "Unable to map the file.", "ecs::detail::MappedFile::MappedFile()" };
+	}
+
+	m_file = file;
+	m_mapping = mapping;
+	m_data = static_cast<unsigned char*>(data);
+	m_size = static_cast<std::size_t>(size.QuadPart);
+
+	#else
+
+	auto const file{ ::open(path.c_str(), O_RDONLY) };
+
+	if (file < 0)
+	{
+		throw Exception{ "Unable to open the file.", "ecs::detail::MappedFile::MappedFile()" };
+	}
+
+	struct stat status{};
+
+	if (::fstat(file, &status) != 0 || status.st_size <= 0)
+	{
+		::close(file);
+		throw Exception{ "Unable to map an empty file.", "ecs::detail::MappedFile::MappedFile()" };
+	}
+
+	auto const size{ static_cast<std::size_t>(status.st_size) };
+
+	// Copy-on-write mapping
+	auto const data{ ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE, file, 0) };
+
+	// The mapping remains valid once the file is closed
+	::close(file);
+
+	if (data == MAP_FAILED)
+	{
+		throw Exception{ "Unable to map the file.", "ecs::detail::MappedFile::MappedFile()" };
+	}
+
+	m_data = static_cast<unsigned char*>(data);
+	m_size = size;
+
+	#endif
+}
+
+ecs::detail::MappedFile::~MappedFile()
+{
+	#ifdef _WIN32
+
+	UnmapViewOfFile(m_data);
+	CloseHandle(m_mapping);
+	CloseHandle(m_file);
+
+	#else
+
+	::munmap(m_data, m_size);
+
+	#endif
+}
+
+unsigned char *ecs::detail::MappedFile::data() const noexcept
+{
+	return m_data;
+}
+
+std::size_t ecs::detail::MappedFile::size() const noexcept
+{
+	return m_size;
+}
@@ -0,0 +1,264 @@
+// Copyright (c) 2021 Ethan Margaillan <contact@ethan.jp>.
+// Licensed under the MIT License - https://raw.githubusercontent.com/Ethan13310/ECS/master/LICENSE
+
+#include <algorithm>
+
+#include <ECS/Detail/MemoryUsage.hpp>
+#include <ECS/Detail/NameTable.hpp>
+
+ecs::detail::NameTable::NameTable(std::pmr::memory_resource *resource) :
+	m_entries{ resource },
+	m_buckets{ resource },
+	m_buffer{ resource }
+{}
+
+bool ecs::detail::NameTable::insert(Entity::Id id, std::string_view name)
+{
+	auto const hash{ HashedName::hash(name) };
+	auto const bucket{ findBucket(name, hash) };
+
+	if (bucket != EMPTY)
+	{
+		return m_buckets[bucket] == id;
+	}
+
+	erase(id);
+
+	// Keep at least one empty bucket out of four so that lookups stay short
+	if ((m_size + m_removed + 1) * 4 > m_buckets.size() * 3)
+	{
+		auto bucketCount{ std::max<std::size_t>(m_buckets.size(), 16) };
+
+		while ((m_size + 1) * 2 > bucketCount)
+		{
+			bucketCount *= 2;
+		}
+
+		rehash(bucketCount);
+	}
+
+	// Most of the buffer is unused, copying the names is worth it
+	if (m_wasted > m_buffer.size() / 2)
+	{
+		compact();
+	}
+
+	if (id >= m_entries.size())
+	{
+		m_entries.resize(id + 1);
+	}
+
+	m_entries[id].offset = m_buffer.size();
+	m_entries[id].length = name.size();
+	m_entries[id].hash = hash;
+
+	m_buffer.append(name);
+
+	auto const mask{ m_buckets.size() - 1 };
+	auto position{ static_cast<std::size_t>(hash) & mask };
+
+	while (m_buckets[position] != EMPTY && m_buckets[position] != REMOVED)
+	{
+		position = (position + 1) & mask;
+	}
+
+	if (m_buckets[position] == REMOVED)
+	{
+		--m_removed;
+	}
+
+	m_buckets[position] = id;
+	++m_size;
+
+	return true;
+}
+
+void ecs::detail::NameTable::erase(Entity::Id id) noexcept
+{
+	if (id >= m_entries.size() || m_entries[id].offset == EMPTY)
+	{
+		return;
+	}
+
+	auto &entry{ m_entries[id] };
+
+	m_buckets[findBucket(view(entry), entry.hash)] = REMOVED;
+	++m_removed;
+	--m_size;
+
+	m_wasted += entry.length;
+	entry = Entry{};
+
+	if (m_size == 0)
+	{
+		clear();
+	}
+}
+
+void ecs::detail::NameTable::clear() noexcept
+{
+	m_entries.clear();
+	std::fill(m_buckets.begin(), m_buckets.end(), EMPTY);
+	m_buffer.clear();
+
+	m_size = 0;
+	m_removed = 0;
+	m_wasted = 0;
+}
+
+void ecs::detail::NameTable::shrinkToFit()
+{
+	// Trailing Entities without name
+	while (!m_entries.empty() && m_entries.back().offset == EMPTY)
+	{
+		m_entries.pop_back();
+	}
+
+	m_entries.shrink_to_fit();
+
+	compact();
+	m_buffer.shrink_to_fit();
+
+	// Smallest index keeping the lookups short
+	std::size_t bucketCount{ 0 };
+
+	if (m_size > 0)
+	{
+		bucketCount = 16;
+
+		while ((m_size + 1) * 2 > bucketCount)
+		{
+			bucketCount *= 2;
+		}
+	}
+
+	if (bucketCount < m_buckets.size())
+	{
+		m_buckets.clear();
+		m_buckets.shrink_to_fit();
+		m_removed = 0;
+
+		if (bucketCount > 0)
+		{
+			rehash(bucketCount);
+		}
+	}
+}
+
+std::optional<ecs::Entity::Id> ecs::detail::NameTable::find(std::string_view name) const noexcept
+{
+	return find(HashedName{ name });
+}
+
+std::optional<ecs::Entity::Id> ecs::detail::NameTable::find(HashedName const &name) const noexcept
+{
+	auto const bucket{ findBucket(name.getName(), name.getHash()) };
+
+	if (bucket == EMPTY)
+	{
+		return std::nullopt;
+	}
+
+	return m_buckets[bucket];
+}
+
+std::optional<std::string_view> ecs::detail::NameTable::getName(Entity::Id id) const noexcept
+{
+	if (id >= m_entries.size() || m_entries[id].offset == EMPTY)
+	{
+		return std::nullopt;
+	}
+
+	return view(m_entries[id]);
+}
+
+std::size_t ecs::detail::NameTable::size() const noexcept
+{
+	return m_size;
+}
+
+ecs::MemoryUsage ecs::detail::NameTable::getMemoryUsage() const noexcept
+{
+	auto memory{ detail::getMemoryUsage(m_entries) };
+
+	memory += detail::getMemoryUsage(m_buckets);
+	memory += detail::getMemoryUsage(m_buffer);
+
+	return memory;
+}
+
+std::size_t ecs::detail::NameTable::findBucket(std::string_view name, HashedName::Hash hash) const noexcept
+{
+	if (m_buckets.empty())
+	{
+		return EMPTY;
+	}
+
+	auto const mask{ m_buckets.size() - 1 };
+	auto position{ static_cast<std::size_t>(hash) & mask };
+
+	// There is always at least one empty bucket
+	while (m_buckets[position] != EMPTY)
+	{
+		auto const id{ m_buckets[position] };
+
+		if (id != REMOVED && m_entries[id].hash == hash && view(m_entries[id]) == name)
+		{
+			return position;
+		}
+
+		position = (position + 1) & mask;
+	}
+
+	return EMPTY;
+}
+
+std::string_view ecs::detail::NameTable::view(Entry const &entry) const noexcept
+{
+	return std::string_view{ m_buffer }.substr(entry.offset, entry.length);
+}
+
+void ecs::detail::NameTable::rehash(std::size_t bucketCount)
+{
+	m_buckets.assign(bucketCount, EMPTY);
+	m_removed = 0;
+
+	auto const mask{ bucketCount - 1 };
+
+	for (Entity::Id id{ 0 }; id < m_entries.size(); ++id)
+	{
+		if (m_entries[id].offset == EMPTY)
+		{
+			continue;
+		}
+
+		auto position{ static_cast<std::size_t>(m_entries[id].hash) & mask };
+
+		while (m_buckets[position] != EMPTY)
+		{
+			position = (position + 1) & mask;
+		}
+
+		m_buckets[position] = id;
+	}
+}
+
+void ecs::detail::NameTable::compact()
+{
+	std::pmr::string buffer{ m_buffer.get_allocator() };
+	buffer.reserve(m_buffer.size() - m_wasted);
+
+	for (auto &entry : m_entries)
+	{
+		if (entry.offset != EMPTY)
+		{
+			auto const offset{ buffer.size() };
+
+			buffer.append(view(entry));
+			entry.offset = offset;
+		}
+	}
+
+	m_buffer.swap(buffer);
+	m_wasted = 0;
+}
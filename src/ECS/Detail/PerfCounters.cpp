@@ -0,0 +1,171 @@
+// Copyright (c) 2021 Ethan Margaillan <contact@ethan.jp>.
+// Licensed under the MIT License - https://raw.githubusercontent.com/Ethan13310/ECS/master/LICENSE
+
+#ifdef __linux__
+	// perf_event_open
+	#include <linux/perf_event.h>
+	#include <sys/ioctl.h>
+	#include <sys/syscall.h>
+	#include <unistd.h>
+#endif
+
+#include <cstring>
+#include <utility>
+
+#include <ECS/Detail/PerfCounters.hpp>
+
+ecs::detail::PerfCounters::~PerfCounters()
+{
+	close();
+}
+
+ecs::detail::PerfCounters::PerfCounters(PerfCounters &&other) noexcept
+{
+	*this = std::move(other);
+}
+
+ecs::detail::PerfCounters &ecs::detail::PerfCounters::operator=(PerfCounters &&other) noexcept
+{
+	if (&other != this)
+	{
+		close();
+
+		m_fds = other.m_fds;
+		m_leader = other.m_leader;
+		m_positions = other.m_positions;
+		m_count = other.m_count;
+
+		other.m_fds.fill(-1);
+		other.m_leader = -1;
+		other.m_count = 0;
+	}
+
+	return *this;
+}
+
+bool ecs::detail::PerfCounters::open()
+{
+	close();
+
+	#ifdef __linux__
+
+	constexpr std::array<std::uint64_t, EVENT_COUNT> configs{
+		PERF_COUNT_HW_CPU_CYCLES,
+		PERF_COUNT_HW_INSTRUCTIONS,
+		PERF_COUNT_HW_CACHE_MISSES,
+		PERF_COUNT_HW_BRANCH_MISSES
+	};
+
+	for (std::size_t event{ 0 }; event < EVENT_COUNT; ++event)
+	{
+		perf_event_attr attr;
+		std::memset(&attr, 0, sizeof(attr));
+
+		attr.type = PERF_TYPE_HARDWARE;
+		attr.size = sizeof(attr);
+		attr.config = configs[event];
+		attr.disabled = m_leader == -1 ? 1 : 0;
+		attr.exclude_kernel = 1;
+		attr.exclude_hv = 1;
+		attr.read_format = PERF_FORMAT_GROUP;
+
+		// Calling thread, any CPU
+		auto const fd{ static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, m_leader, 0)) };
+
+		if (fd == -1)
+		{
+			// This event is not supported, the others may be
+			continue;
+		}
+
+		if (m_leader == -1)
+		{
+			m_leader = fd;
+		}
+
+		m_fds[event] = fd;
+		m_positions[event] = m_count++;
+	}
+
+	if (m_leader == -1)
+	{
+		return false;
+	}
+
+	ioctl(m_leader, PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+	ioctl(m_leader, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+
+	return true;
+
+	#else
+
+	return false;
+
+	#endif
+}
+
+void ecs::detail::PerfCounters::close() noexcept
+{
+	#ifdef __linux__
+
+	// The group leader is closed last
+	for (auto fd{ m_fds.rbegin() }; fd != m_fds.rend(); ++fd)
+	{
+		if (*fd != -1)
+		{
+			::close(*fd);
+			*fd = -1;
+		}
+	}
+
+	#endif
+
+	m_leader = -1;
+	m_count = 0;
+}
+
+bool ecs::detail::PerfCounters::isOpen() const noexcept
+{
+	return m_leader != -1;
+}
+
+bool ecs::detail::PerfCounters::isAvailable(Event event) const noexcept
+{
+	return m_fds[event] != -1;
+}
+
+std::optional<ecs::detail::PerfCounters::Values> ecs::detail::PerfCounters::read() const noexcept
+{
+	#ifdef __linux__
+
+	if (m_leader == -1)
+	{
+		return std::nullopt;
+	}
+
+	// Number of counters, followed by their values
+	std::array<std::uint64_t, EVENT_COUNT + 1> buffer{};
+
+	if (::read(m_leader, buffer.data(), sizeof(buffer)) < static_cast<ssize_t>((m_count + 1) * sizeof(std::uint64_t)))
+	{
+		return std::nullopt;
+	}
+
+	Values values{};
+
+	for (std::size_t event{ 0 }; event < EVENT_COUNT; ++event)
+	{
+		if (m_fds[event] != -1)
+		{
+			values[event] = buffer[m_positions[event] + 1];
+		}
+	}
+
+	return values;
+
+	#else
+
+	return std::nullopt;
+
+	#endif
+}
@@ -2,6 +2,14 @@
 // Licensed under the MIT License - https://raw.githubusercontent.com/Ethan13310/ECS/master/LICENSE
 
 #include <ECS/Detail/SystemHolder.hpp>
+#include <ECS/Detail/TypeName.hpp>
+
+ecs::detail::SystemHolder::SystemHolder(ErrorReport &errorReport, std::pmr::memory_resource *resource) :
+	m_errorReport{ errorReport },
+	m_systems{ resource },
+	m_typeNames{ resource },
+	m_priorities{ resource }
+{}
 
 ecs::detail::SystemHolder::~SystemHolder()
 {
@@ -20,9 +28,24 @@ void ecs::detail::SystemHolder::removeAllSystems()
 	}
 
 	m_systems.clear();
+	m_typeNames.clear();
 	m_priorities.clear();
 }
 
+bool ecs::detail::SystemHolder::hasSystem(detail::TypeId id) const
+{
+	auto const it{ m_systems.find(id) };
+
+	return it != m_systems.end() && it->second != nullptr;
+}
+
+std::string ecs::detail::SystemHolder::getSystemName(detail::TypeId id) const
+{
+	auto const it{ m_typeNames.find(id) };
+
+	return it != m_typeNames.end() ? demangle(it->second) : std::string{};
+}
+
 void ecs::detail::SystemHolder::removeSystemPriority(detail::TypeId id)
 {
 	for (auto it{ m_priorities.begin() }; it != m_priorities.end();) 
@@ -0,0 +1,41 @@
+// Copyright (c) 2021 Ethan Margaillan <contact@ethan.jp>.
+// Licensed under the MIT License - https://raw.githubusercontent.com/Ethan13310/ECS/master/LICENSE
+
+#if defined(__GNUG__)
+	// abi::__cxa_demangle
+	#include <cxxabi.h>
+#endif
+
+#include <cstdlib>
+#include <memory>
+#include <string_view>
+
+#include <ECS/Detail/TypeName.hpp>
+
+std::string ecs::detail::demangle(char const *typeName)
+{
+	#if defined(__GNUG__)
+
+	int status{ 0 };
+	std::unique_ptr<char, void (*)(void *)> const demangled{ abi::__cxa_demangle(typeName, nullptr, nullptr, &status), std::free };
+
+	if (status == 0 && demangled != nullptr)
+	{
+		return demangled.get();
+	}
+
+	#endif
+
+	std::string name{ typeName };
+
+	// MSVC prefixes the names with the kind of type
+	for (std::string_view const prefix : { "class ", "struct " })
+	{
+		if (name.compare(0, prefix.size(), prefix) == 0)
+		{
+			name.erase(0, prefix.size());
+		}
+	}
+
+	return name;
+}
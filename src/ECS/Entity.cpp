@@ -24,6 +24,7 @@ ecs::Entity::Id ecs::Entity::getId() const noexcept
 void ecs::Entity::removeAllComponents()
 {
 	m_world.value()->refreshEntity(m_id);
+	m_world.value()->countRemovedComponents(m_id);
 	
 	m_world.value()->m_components.removeAllComponents(m_id);
 }
@@ -0,0 +1,244 @@
+// Copyright (c) 2021 Ethan Margaillan <contact@ethan.jp>.
+// Licensed under the MIT License - https://raw.githubusercontent.com/Ethan13310/ECS/master/LICENSE
+
+#include <algorithm>
+#include <string>
+#include <utility>
+
+#include <ECS/ErrorReport.hpp>
+#include <ECS/HashedName.hpp>
+#include <ECS/Log.hpp>
+
+void ecs::ErrorReport::report(std::string_view site, std::string_view message)
+{
+	// Repeated occurrences of the forgotten errors
+	std::vector<std::string> lines;
+	auto first{ false };
+
+	{
+		std::lock_guard<std::mutex> lock{ m_mutex };
+
+		auto const key{ hash(site, message) };
+		auto index{ find(key, site, message) };
+
+		if (index == npos)
+		{
+			// Make room for the new error
+			evict(m_capacity - 1, lines);
+
+			index = m_entries.size();
+
+			m_entries.emplace_back();
+			m_entries.back().counter.site = site;
+			m_entries.back().counter.message = message;
+			m_entries.back().hash = key;
+
+			m_index.emplace(key, index);
+		}
+
+		auto &entry{ m_entries[index] };
+		++entry.counter.count;
+		entry.lastReport = m_reports++;
+
+		if (entry.active)
+		{
+			++entry.repeated;
+		}
+		else
+		{
+			entry.active = true;
+			first = true;
+		}
+	}
+
+	// The log is written once the report is unlocked
+	for (auto const &line : lines)
+	{
+		Log::error(line);
+	}
+
+	if (first)
+	{
+		Log::error(message);
+	}
+}
+
+void ecs::ErrorReport::endFrame()
+{
+	std::vector<std::string> lines;
+
+	{
+		std::lock_guard<std::mutex> lock{ m_mutex };
+
+		if (++m_frames >= m_window)
+		{
+			lines = endWindow();
+		}
+	}
+
+	for (auto const &line : lines)
+	{
+		Log::error(line);
+	}
+}
+
+void ecs::ErrorReport::setWindow(std::size_t frames)
+{
+	std::lock_guard<std::mutex> lock{ m_mutex };
+
+	m_window = std::max<std::size_t>(frames, 1);
+}
+
+void ecs::ErrorReport::setCapacity(std::size_t capacity)
+{
+	std::vector<std::string> lines;
+
+	{
+		std::lock_guard<std::mutex> lock{ m_mutex };
+
+		m_capacity = std::max<std::size_t>(capacity, 1);
+		evict(m_capacity, lines);
+	}
+
+	for (auto const &line : lines)
+	{
+		Log::error(line);
+	}
+}
+
+std::size_t ecs::ErrorReport::getCapacity() const
+{
+	std::lock_guard<std::mutex> lock{ m_mutex };
+
+	return m_capacity;
+}
+
+std::size_t ecs::ErrorReport::getCount(std::string_view site, std::string_view message) const
+{
+	std::lock_guard<std::mutex> lock{ m_mutex };
+
+	auto const index{ find(hash(site, message), site, message) };
+
+	return index != npos ? m_entries[index].counter.count : 0;
+}
+
+std::vector<ecs::ErrorReport::Counter> ecs::ErrorReport::getCounters() const
+{
+	std::lock_guard<std::mutex> lock{ m_mutex };
+
+	std::vector<Counter> counters;
+	counters.reserve(m_entries.size());
+
+	for (auto const &entry : m_entries)
+	{
+		counters.push_back(entry.counter);
+	}
+
+	return counters;
+}
+
+void ecs::ErrorReport::reset()
+{
+	std::lock_guard<std::mutex> lock{ m_mutex };
+
+	m_entries.clear();
+	m_index.clear();
+	m_frames = 0;
+}
+
+std::uint64_t ecs::ErrorReport::hash(std::string_view site, std::string_view message) noexcept
+{
+	return HashedName::hash(site) * 31 + HashedName::hash(message);
+}
+
+std::size_t ecs::ErrorReport::find(std::uint64_t hash, std::string_view site, std::string_view message) const noexcept
+{
+	auto const range{ m_index.equal_range(hash) };
+
+	for (auto it{ range.first }; it != range.second; ++it)
+	{
+		auto const &counter{ m_entries[it->second].counter };
+
+		if (counter.site == site && counter.message == message)
+		{
+			return it->second;
+		}
+	}
+
+	return npos;
+}
+
+void ecs::ErrorReport::evict(std::size_t count, std::vector<std::string> &lines)
+{
+	while (m_entries.size() > count)
+	{
+		auto const oldest{ std::min_element(m_entries.begin(), m_entries.end(), [](Entry const &lhs, Entry const &rhs)
+		{
+			return lhs.lastReport < rhs.lastReport;
+		}) };
+
+		// The occurrences not logged yet are summarized before being forgotten
+		if (oldest->repeated > 0)
+		{
+			lines.push_back(summarize(*oldest));
+		}
+
+		auto const index{ static_cast<std::size_t>(oldest - m_entries.begin()) };
+		auto const last{ m_entries.size() - 1 };
+
+		eraseIndex(oldest->hash, index);
+
+		// The last error takes the place of the forgotten one
+		if (index != last)
+		{
+			eraseIndex(m_entries[last].hash, last);
+			m_index.emplace(m_entries[last].hash, index);
+			m_entries[index] = std::move(m_entries[last]);
+		}
+
+		m_entries.pop_back();
+	}
+}
+
+void ecs::ErrorReport::eraseIndex(std::uint64_t hash, std::size_t index) noexcept
+{
+	auto const range{ m_index.equal_range(hash) };
+
+	for (auto it{ range.first }; it != range.second; ++it)
+	{
+		if (it->second == index)
+		{
+			m_index.erase(it);
+			return;
+		}
+	}
+}
+
+std::vector<std::string> ecs::ErrorReport::endWindow()
+{
+	std::vector<std::string> lines;
+
+	for (auto &entry : m_entries)
+	{
+		if (entry.repeated > 0)
+		{
+			lines.push_back(summarize(entry));
+		}
+		else
+		{
+			// The error has not occurred during the whole window
+			entry.active = false;
+		}
+
+		entry.repeated = 0;
+	}
+
+	m_frames = 0;
+
+	return lines;
+}
+
+std::string ecs::ErrorReport::summarize(Entry const &entry)
+{
+	return entry.counter.message + " (repeated " + std::to_string(entry.repeated) + " times in " + entry.counter.site + ")";
+}
@@ -1,8 +1,16 @@
 // Copyright (c) 2021 Ethan Margaillan <contact@ethan.jp>.
 // Licensed under the MIT License - https://raw.githubusercontent.com/Ethan13310/ECS/master/LICENSE
 
+#include <algorithm>
+
+#include <ECS/Detail/MemoryUsage.hpp>
 #include <ECS/EventDispatcher.hpp>
 
+ecs::EventDispatcher::EventDispatcher(std::pmr::memory_resource *resource) :
+	m_listeners{ resource },
+	m_emitCounts{ resource }
+{}
+
 void ecs::EventDispatcher::clearAll()
 {
 	m_listeners.clear();
@@ -22,3 +30,23 @@ void ecs::EventDispatcher::clear(Event::Id id)
 		}
 	}
 }
+
+void ecs::EventDispatcher::shrinkToFit()
+{
+	m_listeners.rehash(0);
+}
+
+ecs::MemoryUsage ecs::EventDispatcher::getMemoryUsage() const noexcept
+{
+	return detail::getNodeMemoryUsage(m_listeners);
+}
+
+std::pmr::vector<std::size_t> const &ecs::EventDispatcher::getEmitCounts() const noexcept
+{
+	return m_emitCounts;
+}
+
+void ecs::EventDispatcher::resetEmitCounts() noexcept
+{
+	std::fill(m_emitCounts.begin(), m_emitCounts.end(), 0);
+}
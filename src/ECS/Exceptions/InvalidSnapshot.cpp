@@ -0,0 +1,8 @@
+// Copyright (c) 2021 Ethan Margaillan <contact@ethan.jp>.
+// Licensed under the MIT License - https://raw.githubusercontent.com/Ethan13310/ECS/master/LICENSE
+
+#include <ECS/Exceptions/InvalidSnapshot.hpp>
+
+ecs::InvalidSnapshot::InvalidSnapshot(std::string const &function) :
+	Exception{ "Invalid snapshot.", function }
+{}
@@ -10,32 +10,150 @@
 #endif
 
 #include <chrono>
+#include <condition_variable>
 #include <ctime>
 #include <iomanip>
 #include <iostream>
+#include <mutex>
 #include <sstream>
+#include <thread>
 
+#include <ECS/Detail/LogBuffer.hpp>
 #include <ECS/Log.hpp>
 
-void ecs::Log::info(std::string const &message)
+class ecs::Log::AsyncWriter
 {
-	log("info", Color::Cyan, message);
-}
+public:
+	explicit AsyncWriter(std::size_t capacity) :
+		m_buffer{ capacity },
+		m_thread{ [this] { run(); } }
+	{}
 
-void ecs::Log::success(std::string const &message)
-{
-	log("success", Color::Green, message);
-}
+	~AsyncWriter()
+	{
+		// The messages logged from now on are printed right away
+		m_writer.store(nullptr, std::memory_order_release);
 
-void ecs::Log::warning(std::string const &message)
-{
-	log("warning", Color::Yellow, message);
-}
+		{
+			std::lock_guard<std::mutex> lock{ m_mutex };
+			m_running = false;
+		}
 
-void ecs::Log::error(std::string const &message)
-{
-	log("error", Color::Red, message);
-}
+		m_condition.notify_all();
+		m_thread.join();
+	}
+
+	AsyncWriter(AsyncWriter const &) = delete;
+	AsyncWriter(AsyncWriter &&) = delete;
+
+	AsyncWriter &operator=(AsyncWriter const &) = delete;
+	AsyncWriter &operator=(AsyncWriter &&) = delete;
+
+	// Queue a message
+	void push(Level level, std::string_view message)
+	{
+		if (!m_buffer.push(static_cast<std::size_t>(level), message))
+		{
+			m_dropped.fetch_add(1, std::memory_order_relaxed);
+			return;
+		}
+
+		m_pushed.fetch_add(1, std::memory_order_release);
+		m_condition.notify_one();
+	}
+
+	// Wait until the messages queued so far have been printed
+	void flush()
+	{
+		auto const target{ m_pushed.load(std::memory_order_acquire) };
+
+		std::unique_lock<std::mutex> lock{ m_mutex };
+		m_condition.notify_all();
+
+		m_flushed.wait(lock, [&]
+		{
+			return m_written >= target;
+		});
+	}
+
+private:
+	// Print the queued messages until the writer is destroyed
+	void run()
+	{
+		std::string line;
+		std::unique_lock<std::mutex> lock{ m_mutex };
+
+		for (;;)
+		{
+			lock.unlock();
+
+			// Messages are printed without holding the lock, the logging
+			// threads never wait for the console
+			auto const count{ m_buffer.consume([&](detail::LogBuffer::Record const &record)
+			{
+				write(static_cast<Level>(record.level), record.time, record.message, line);
+			}) };
+
+			auto const dropped{ m_dropped.exchange(0, std::memory_order_relaxed) };
+
+			if (dropped > 0)
+			{
+				write(Level::Warning, Clock::now(), std::to_string(dropped) + " log message(s) dropped, the log buffer is full.", line);
+			}
+
+			if (count > 0 || dropped > 0)
+			{
+				std::cout.flush();
+			}
+
+			lock.lock();
+
+			m_written += count;
+			m_flushed.notify_all();
+
+			if (!m_running && m_buffer.empty())
+			{
+				return;
+			}
+
+			// Pushes do not take the lock, so a notification may be missed
+			m_condition.wait_for(lock, std::chrono::milliseconds{ 50 }, [&]
+			{
+				return !m_running || !m_buffer.empty() || m_written < m_pushed.load(std::memory_order_acquire);
+			});
+		}
+	}
+
+	// Queued messages
+	detail::LogBuffer m_buffer;
+
+	// Number of messages queued
+	std::atomic<std::size_t> m_pushed{ 0 };
+
+	// Number of messages dropped since the last print
+	std::atomic<std::size_t> m_dropped{ 0 };
+
+	// Number of messages printed, guarded by m_mutex
+	std::size_t m_written{ 0 };
+
+	// Is the writer running, guarded by m_mutex
+	bool m_running{ true };
+
+	std::mutex m_mutex;
+
+	// Wakes the background thread up
+	std::condition_variable m_condition;
+
+	// Notified each time messages have been printed
+	std::condition_variable m_flushed;
+
+	// Must be constructed last, since it uses the other members
+	std::thread m_thread;
+};
+
+std::unique_ptr<ecs::Log::AsyncWriter> ecs::Log::m_asyncWriter;
+
+std::atomic<ecs::Log::AsyncWriter*> ecs::Log::m_writer{ nullptr };
 
 void ecs::Log::enableColors(bool enable)
 {
@@ -52,40 +170,100 @@ bool ecs::Log::colorsEnabled() noexcept
 	return m_enableColors;
 }
 
-void ecs::Log::log(std::string const &header, Color headerColor, std::string const &message)
+void ecs::Log::enableAsync(bool enable, std::size_t capacity)
 {
-	if (m_enableDateTime) 
+	if (enable && m_asyncWriter == nullptr)
 	{
-		printHeader(getDate(), Color::Default);
+		m_asyncWriter = std::make_unique<AsyncWriter>(capacity);
+		m_writer.store(m_asyncWriter.get(), std::memory_order_release);
 	}
+	else if (!enable && m_asyncWriter != nullptr)
+	{
+		// The remaining messages are printed before the thread stops
+		m_writer.store(nullptr, std::memory_order_release);
+		m_asyncWriter.reset();
+	}
+}
 
-	printHeader(header, headerColor);
-	printLine(message);
+bool ecs::Log::asyncEnabled() noexcept
+{
+	return m_writer.load(std::memory_order_acquire) != nullptr;
 }
 
-void ecs::Log::printHeader(std::string const &str, Color color)
+void ecs::Log::flush()
 {
-	print("[ ");
+	auto const writer{ m_writer.load(std::memory_order_acquire) };
 
-	format(Style::Bold);
-	format(color);
-	print(str);
+	if (writer != nullptr)
+	{
+		writer->flush();
+	}
 
-	format(Style::Default);
-	print(" ] ");
+	std::cout.flush();
 }
 
-void ecs::Log::printLine(std::string const &message)
+void ecs::Log::log(Level level, std::string_view message)
 {
-	std::cout << message << std::endl;
+	auto const writer{ m_writer.load(std::memory_order_acquire) };
+
+	if (writer != nullptr)
+	{
+		writer->push(level, message);
+		return;
+	}
+
+	std::string line;
+
+	write(level, Clock::now(), message, line);
+	std::cout.flush();
 }
 
-void ecs::Log::print(std::string const &message)
+void ecs::Log::write(Level level, Clock::time_point time, std::string_view message, std::string &line)
 {
-	std::cout << message;
+	line.clear();
+
+	if (m_enableDateTime) 
+	{
+		printHeader(line, getDate(time), Color::Default);
+	}
+
+	switch (level)
+	{
+	case Level::Info:
+		printHeader(line, "info", Color::Cyan);
+		break;
+
+	case Level::Success:
+		printHeader(line, "success", Color::Green);
+		break;
+
+	case Level::Warning:
+		printHeader(line, "warning", Color::Yellow);
+		break;
+
+	default:
+		printHeader(line, "error", Color::Red);
+	}
+
+	line += message;
+	line += '\n';
+
+	std::cout.write(line.data(), static_cast<std::streamsize>(line.size()));
+}
+
+void ecs::Log::printHeader(std::string &line, std::string_view str, Color color)
+{
+	line += "[ ";
+
+	format(line, Style::Bold);
+	format(line, color);
+	line += str;
+
+	format(line, Style::Default);
+	line += " ] ";
 }
 
-void ecs::Log::format(Style style)
+void ecs::Log::format(std::string &line, Style style)
 {
 	if (!m_enableColors)
 	{
@@ -95,19 +273,19 @@ void ecs::Log::format(Style style)
 	switch (style)
 	{
 	case Style::Bold:
-		std::cout << "\033[1m";
+		line += "\033[1m";
 		break;
 
 	case Style::Underline:
-		std::cout << "\033[4m";
+		line += "\033[4m";
 		break;
 
 	default:
-		std::cout << "\033[0m";
+		line += "\033[0m";
 	}
 }
 
-void ecs::Log::format(Color color)
+void ecs::Log::format(std::string &line, Color color)
 {
 	if (!m_enableColors)
 	{
@@ -117,33 +295,32 @@ void ecs::Log::format(Color color)
 	switch (color)
 	{
 	case Color::Cyan:
-		std::cout << "\033[96m";
+		line += "\033[96m";
 		break;
 
 	case Color::Green:
-		std::cout << "\033[92m";
+		line += "\033[92m";
 		break;
 
 	case Color::Yellow:
-		std::cout << "\033[93m";
+		line += "\033[93m";
 		break;
 
 	case Color::Red:
-		std::cout << "\033[91m";
+		line += "\033[91m";
 		break;
 
 	default:
-		std::cout << "\033[39m";
+		line += "\033[39m";
 	}
 }
 
-std::string ecs::Log::getDate()
+std::string ecs::Log::getDate(Clock::time_point time)
 {
-	auto const now{ std::chrono::system_clock::now() };
-	auto const time{ std::chrono::system_clock::to_time_t(now) };
+	auto const timeT{ Clock::to_time_t(time) };
 
 	std::ostringstream ss;
-	ss << std::put_time(std::localtime(&time), "%X");
+	ss << std::put_time(std::localtime(&timeT), "%X");
 	
 	return ss.str();
 }
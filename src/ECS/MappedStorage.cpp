@@ -0,0 +1,432 @@
+// Copyright (c) 2021 Ethan Margaillan <contact@ethan.jp>.
+// Licensed under the MIT License - https://raw.githubusercontent.com/Ethan13310/ECS/master/LICENSE
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <memory>
+#include <type_traits>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include <ECS/Detail/ComponentFilter.hpp>
+#include <ECS/Detail/ComponentPool.hpp>
+#include <ECS/Detail/MappedFile.hpp>
+#include <ECS/Detail/NameTable.hpp>
+#include <ECS/Exceptions/Exception.hpp>
+#include <ECS/Exceptions/InvalidSnapshot.hpp>
+#include <ECS/MappedStorage.hpp>
+#include <ECS/Snapshot.hpp>
+#include <ECS/World.hpp>
+
+namespace
+{
+	// Mapped file signature
+	constexpr char MAPPED_MAGIC[4]{ 'E', 'C', 'S', 'M' };
+
+	// Alignment of the sections of the file
+	constexpr std::uint64_t FILE_ALIGNMENT{ 4096 };
+
+	// Entity flags
+	constexpr std::uint8_t ENTITY_VALID{ 1 << 0 };
+	constexpr std::uint8_t ENTITY_ENABLED{ 1 << 1 };
+
+	struct MappedHeader
+	{
+		char magic[4];
+		std::uint32_t version;
+
+		// Size of the Entity table
+		std::uint64_t entityCount;
+
+		// Size of the pages of the Component pools
+		std::uint64_t pageSize;
+
+		// Entity flags, one byte per Entity
+		std::uint64_t flagsOffset;
+
+		// Free Entity IDs
+		std::uint64_t freeIdsOffset;
+		std::uint64_t freeIdsCount;
+
+		// Entity names, stored as ID, length, characters
+		std::uint64_t namesOffset;
+		std::uint64_t namesCount;
+
+		// Component columns
+		std::uint64_t columnsOffset;
+		std::uint64_t columnCount;
+	};
+
+	struct MappedColumn
+	{
+		std::uint32_t stableId;
+		std::uint32_t reserved;
+
+		// Size and alignment of the Component
+		std::uint64_t size;
+		std::uint64_t alignment;
+
+		// Number of Components
+		std::uint64_t count;
+
+		// Owner of each Component
+		std::uint64_t ownersOffset;
+
+		// Component data, padded to a whole number of pages
+		std::uint64_t dataOffset;
+		std::uint64_t dataSize;
+	};
+
+	static_assert(std::is_trivially_copyable<MappedHeader>::value && sizeof(MappedHeader) == 80, "Unexpected header layout.");
+	static_assert(std::is_trivially_copyable<MappedColumn>::value && sizeof(MappedColumn) == 56, "Unexpected column layout.");
+
+	void writeBytes(std::ostream &stream, void const *data, std::size_t size)
+	{
+		stream.write(static_cast<char const*>(data), static_cast<std::streamsize>(size));
+	}
+
+	template <class T>
+	void writeValue(std::ostream &stream, T const &value)
+	{
+		writeBytes(stream, &value, sizeof(T));
+	}
+
+	// Pad the stream with zeros up to the alignment, then return the position
+	std::uint64_t pad(std::ostream &stream, std::uint64_t alignment)
+	{
+		auto const position{ static_cast<std::uint64_t>(stream.tellp()) };
+		auto const padding{ (alignment - position % alignment) % alignment };
+
+		std::vector<char> const zeros(static_cast<std::size_t>(padding), 0);
+		writeBytes(stream, zeros.data(), zeros.size());
+
+		return position + padding;
+	}
+
+	// Bounds-checked access to the mapped file
+	class MappedReader
+	{
+	public:
+		explicit MappedReader(ecs::detail::MappedFile const &file) :
+			m_file{ file }
+		{}
+
+		// Get the address of a section, after checking that it fits into the file
+		unsigned char *section(std::uint64_t offset, std::uint64_t count, std::uint64_t size, std::uint64_t alignment = 1) const
+		{
+			if (offset % alignment != 0 || offset > m_file.size() || (size != 0 && count > (m_file.size() - offset) / size))
+			{
+				throw ecs::InvalidSnapshot{ "ecs::MappedStorage::open()" };
+			}
+
+			return m_file.data() + offset;
+		}
+
+		// Read a value and move the offset forward
+		template <class T>
+		T read(std::uint64_t &offset) const
+		{
+			T value{};
+			std::memcpy(&value, section(offset, 1, sizeof(T)), sizeof(T));
+			offset += sizeof(T);
+
+			return value;
+		}
+
+	private:
+		ecs::detail::MappedFile const &m_file;
+	};
+}
+
+ecs::MappedStorage::MappedStorage(ComponentRegistry const &registry) :
+	m_registry{ registry }
+{}
+
+void ecs::MappedStorage::save(World const &world, std::string const &path) const
+{
+	std::ofstream stream{ path, std::ios::binary | std::ios::trunc };
+
+	if (!stream)
+	{
+		throw Exception{ "Unable to open the file.", "ecs::MappedStorage::save()" };
+	}
+
+	MappedHeader header{};
+	std::copy(std::begin(MAPPED_MAGIC), std::end(MAPPED_MAGIC), std::begin(header.magic));
+	header.version = SNAPSHOT_VERSION;
+	header.entityCount = world.m_entities.size();
+	header.pageSize = detail::ComponentPool::PAGE_SIZE;
+
+	// The header is written once all the offsets are known
+	writeValue(stream, header);
+
+	// Entity table
+	header.flagsOffset = pad(stream, FILE_ALIGNMENT);
+
+	for (auto const &attributes : world.m_entities)
+	{
+		std::uint8_t flags{ 0 };
+
+		if (attributes.isValid)
+		{
+			flags |= ENTITY_VALID;
+			flags |= attributes.isEnabled ? ENTITY_ENABLED : 0;
+		}
+
+		writeValue(stream, flags);
+	}
+
+	// Free Entity IDs
+	auto const &storedIds{ world.m_pool.getStoredIds() };
+	std::vector<std::uint64_t> const freeIds(storedIds.begin(), storedIds.end());
+
+	header.freeIdsOffset = pad(stream, sizeof(std::uint64_t));
+	header.freeIdsCount = freeIds.size();
+	writeBytes(stream, freeIds.data(), freeIds.size() * sizeof(std::uint64_t));
+
+	// Entity names
+	header.namesOffset = pad(stream, sizeof(std::uint64_t));
+	header.namesCount = world.m_names.size();
+
+	world.m_names.forEach([&](Entity::Id id, std::string_view name)
+	{
+		writeValue<std::uint64_t>(stream, id);
+		writeValue<std::uint64_t>(stream, name.size());
+		writeBytes(stream, name.data(), name.size());
+	});
+
+	// Component columns, with the same layout as the pool pages
+	std::vector<MappedColumn> columns;
+
+	for (detail::TypeId typeId{ 0 }; typeId < MAX_COMPONENTS; ++typeId)
+	{
+		auto const pool{ world.m_components.getPool(typeId) };
+		auto const stableId{ m_registry->getStableId(typeId) };
+
+		if (pool == nullptr || pool->size() == 0 || !stableId.has_value())
+		{
+			continue;
+		}
+
+		auto const &info{ pool->getInfo() };
+		auto const pageBytes{ pool->getPageSlots() * info.size };
+
+		MappedColumn column{};
+		column.stableId = stableId.value();
+		column.size = info.size;
+		column.alignment = info.alignment;
+		column.count = pool->size();
+
+		std::vector<std::uint64_t> owners;
+		owners.reserve(pool->size());
+
+		column.ownersOffset = pad(stream, sizeof(std::uint64_t));
+
+		pool->forEach([&](Entity::Id id, void const *)
+		{
+			owners.push_back(id);
+		});
+
+		writeBytes(stream, owners.data(), owners.size() * sizeof(std::uint64_t));
+
+		column.dataOffset = pad(stream, std::max<std::uint64_t>(FILE_ALIGNMENT, info.alignment));
+
+		pool->forEach([&](Entity::Id, void const *component)
+		{
+			writeBytes(stream, component, info.size);
+		});
+
+		// Complete the last page
+		column.dataSize = (column.count * info.size + pageBytes - 1) / pageBytes * pageBytes;
+
+		std::vector<char> const zeros(static_cast<std::size_t>(column.dataSize - column.count * info.size), 0);
+		writeBytes(stream, zeros.data(), zeros.size());
+
+		columns.push_back(column);
+	}
+
+	header.columnsOffset = pad(stream, sizeof(std::uint64_t));
+	header.columnCount = columns.size();
+	writeBytes(stream, columns.data(), columns.size() * sizeof(MappedColumn));
+
+	stream.seekp(0);
+	writeValue(stream, header);
+
+	if (!stream.flush())
+	{
+		throw Exception{ "Unable to write the file.", "ecs::MappedStorage::save()" };
+	}
+}
+
+void ecs::MappedStorage::open(World &world, std::string const &path) const
+{
+	auto const file{ std::make_shared<detail::MappedFile>(path) };
+	MappedReader const reader{ *file };
+
+	// The whole file is checked before the World is modified, but the
+	// Components themselves are not read
+	MappedHeader header{};
+	std::memcpy(&header, reader.section(0, 1, sizeof(MappedHeader)), sizeof(MappedHeader));
+
+	if (!std::equal(std::begin(header.magic), std::end(header.magic), std::begin(MAPPED_MAGIC)) ||
+		header.version != SNAPSHOT_VERSION || header.pageSize != detail::ComponentPool::PAGE_SIZE)
+	{
+		throw InvalidSnapshot{ "ecs::MappedStorage::open()" };
+	}
+
+	// Entity table
+	auto const flags{ reader.section(header.flagsOffset, header.entityCount, sizeof(std::uint8_t)) };
+	auto const entityCount{ static_cast<std::size_t>(header.entityCount) };
+
+	auto const isValid = [&](std::uint64_t id)
+	{
+		return id < entityCount && (flags[id] & ENTITY_VALID) != 0;
+	};
+
+	// Free Entity IDs
+	// The counts are checked against the file before anything is allocated
+	auto const freeIdsData{ reader.section(header.freeIdsOffset, header.freeIdsCount, sizeof(std::uint64_t)) };
+	std::vector<Entity::Id> freeIds(static_cast<std::size_t>(header.freeIdsCount));
+	std::memcpy(freeIds.data(), freeIdsData, freeIds.size() * sizeof(std::uint64_t));
+
+	for (auto const id : freeIds)
+	{
+		if (id >= entityCount || isValid(id))
+		{
+			throw InvalidSnapshot{ "ecs::MappedStorage::open()" };
+		}
+	}
+
+	// Entity names
+	detail::NameTable names;
+	auto offset{ header.namesOffset };
+
+	for (std::uint64_t i{ 0 }; i < header.namesCount; ++i)
+	{
+		auto const id{ reader.read<std::uint64_t>(offset) };
+		auto const length{ reader.read<std::uint64_t>(offset) };
+		auto const characters{ reader.section(offset, length, sizeof(char)) };
+
+		offset += length;
+
+		if (!isValid(id) || names.getName(id).has_value() || !names.insert(id, std::string_view{ reinterpret_cast<char const*>(characters), static_cast<std::size_t>(length) }))
+		{
+			throw InvalidSnapshot{ "ecs::MappedStorage::open()" };
+		}
+	}
+
+	// Component columns
+	auto const columnsData{ reader.section(header.columnsOffset, header.columnCount, sizeof(MappedColumn)) };
+	std::vector<MappedColumn> columns(static_cast<std::size_t>(header.columnCount));
+	std::memcpy(columns.data(), columnsData, columns.size() * sizeof(MappedColumn));
+
+	std::vector<detail::ComponentInfo const*> infos;
+	std::vector<std::vector<Entity::Id>> owners;
+	std::vector<detail::ComponentFilter::Mask> masks(entityCount);
+
+	for (auto const &column : columns)
+	{
+		auto const info{ m_registry->getInfo(column.stableId) };
+
+		if (info == nullptr)
+		{
+			// Unregistered Component type, the column is skipped
+			continue;
+		}
+
+		if (info->size != column.size || info->alignment != column.alignment || info->typeId >= MAX_COMPONENTS)
+		{
+			throw InvalidSnapshot{ "ecs::MappedStorage::open()" };
+		}
+
+		// One owner per Component: the count is bounded by the size of the
+		// file, so the size of the Components cannot overflow
+		auto const ownersData{ reader.section(column.ownersOffset, column.count, sizeof(std::uint64_t)) };
+
+		auto const pageBytes{ std::max<std::uint64_t>(1, detail::ComponentPool::PAGE_SIZE / info->size) * info->size };
+
+		if (column.count > (std::numeric_limits<std::uint64_t>::max() - pageBytes) / info->size)
+		{
+			throw InvalidSnapshot{ "ecs::MappedStorage::open()" };
+		}
+
+		auto const pages{ (column.count * info->size + pageBytes - 1) / pageBytes };
+
+		if (column.dataSize < pages * pageBytes)
+		{
+			throw InvalidSnapshot{ "ecs::MappedStorage::open()" };
+		}
+
+		// The Components themselves are only checked to fit into the file
+		reader.section(column.dataOffset, column.dataSize, 1, column.alignment);
+
+		std::vector<Entity::Id> ids(static_cast<std::size_t>(column.count));
+		std::memcpy(ids.data(), ownersData, ids.size() * sizeof(std::uint64_t));
+
+		for (auto const id : ids)
+		{
+			// An Entity cannot own the same Component twice
+			if (!isValid(id) || masks[id][info->typeId])
+			{
+				throw InvalidSnapshot{ "ecs::MappedStorage::open()" };
+			}
+
+			masks[id].set(info->typeId);
+		}
+
+		infos.push_back(info);
+		owners.push_back(std::move(ids));
+	}
+
+	// Replace the content of the World
+	world.resetEntities();
+	world.extend(entityCount);
+
+	for (std::size_t id{ 0 }; id < entityCount; ++id)
+	{
+		auto &attributes{ world.m_entities[id] };
+
+		attributes.entity = Entity{ id, world };
+		attributes.isValid = (flags[id] & ENTITY_VALID) != 0;
+		attributes.isEnabled = attributes.isValid && (flags[id] & ENTITY_ENABLED) != 0;
+		attributes.isDisabled = attributes.isValid && !attributes.isEnabled;
+
+		world.markChanged(id);
+	}
+
+	world.m_pool.restore(entityCount, freeIds);
+
+	world.m_names = std::move(names);
+
+	// The pools use the mapped Components directly
+	std::size_t index{ 0 };
+
+	for (auto const &column : columns)
+	{
+		if (m_registry->getInfo(column.stableId) == nullptr)
+		{
+			continue;
+		}
+
+		auto &pool{ world.m_components.getOrCreatePool(*infos[index]) };
+		pool.adopt(file->data() + column.dataOffset, std::move(owners[index]), file);
+
+		++index;
+	}
+
+	// The Entities will be attached to the Systems on the next update
+	world.m_actions.reserve(entityCount);
+
+	for (std::size_t id{ 0 }; id < entityCount; ++id)
+	{
+		if (world.m_entities[id].isValid)
+		{
+			world.m_components.setComponentsMask(id, masks[id]);
+			world.refreshEntity(id);
+		}
+	}
+}
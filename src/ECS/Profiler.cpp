@@ -0,0 +1,302 @@
+// Copyright (c) 2021 Ethan Margaillan <contact@ethan.jp>.
+// Licensed under the MIT License - https://raw.githubusercontent.com/Ethan13310/ECS/master/LICENSE
+
+#include <algorithm>
+#include <fstream>
+#include <utility>
+
+#include <ECS/Detail/TypeName.hpp>
+#include <ECS/Exceptions/Exception.hpp>
+#include <ECS/Profiler.hpp>
+
+namespace
+{
+	// Write a string as a JSON string
+	void writeString(std::ostream &stream, std::string_view str)
+	{
+		stream << '"';
+
+		for (auto const c : str)
+		{
+			if (c == '"' || c == '\\')
+			{
+				stream << '\\';
+			}
+
+			stream << c;
+		}
+
+		stream << '"';
+	}
+
+	// Convert a duration into microseconds, the unit of the Chrome traces
+	double toMicroseconds(ecs::Profiler::Clock::duration duration)
+	{
+		return std::chrono::duration<double, std::micro>(duration).count();
+	}
+}
+
+void ecs::Profiler::enable(bool enable) noexcept
+{
+	m_enabled = enable;
+}
+
+bool ecs::Profiler::isEnabled() const noexcept
+{
+	return m_enabled;
+}
+
+std::vector<ecs::Profiler::Stats> ecs::Profiler::getStats() const
+{
+	std::vector<Stats> stats;
+	stats.reserve(m_sections.size());
+
+	std::vector<Clock::duration> samples;
+
+	for (auto const &section : m_sections)
+	{
+		if (section.calls == 0)
+		{
+			continue;
+		}
+
+		Stats stat;
+		stat.name = section.name;
+		stat.calls = section.calls;
+		stat.min = section.min;
+		stat.max = section.max;
+		stat.total = section.total;
+		stat.average = section.total / static_cast<Clock::rep>(section.calls);
+		stat.entityCount = section.entityCount;
+
+		stat.counters = getCounters(section.counters);
+
+		if (section.counterCalls > 0)
+		{
+			auto average{ section.totalCounters };
+
+			for (auto &value : average)
+			{
+				value /= section.counterCalls;
+			}
+
+			stat.averageCounters = getCounters(average);
+		}
+
+		samples = section.samples;
+
+		auto const rank{ samples.size() * 99 / 100 };
+		std::nth_element(samples.begin(), samples.begin() + static_cast<std::ptrdiff_t>(rank), samples.end());
+		stat.p99 = samples[rank];
+
+		stats.push_back(std::move(stat));
+	}
+
+	std::sort(stats.begin(), stats.end(), [](Stats const &lhs, Stats const &rhs)
+	{
+		return lhs.total > rhs.total;
+	});
+
+	return stats;
+}
+
+void ecs::Profiler::reset()
+{
+	for (auto &section : m_sections)
+	{
+		auto name{ std::move(section.name) };
+		section = Section{};
+		section.name = std::move(name);
+	}
+
+	m_traceEvents.clear();
+	m_traceStart = Clock::now();
+}
+
+void ecs::Profiler::startTrace(std::string path)
+{
+	m_tracePath = std::move(path);
+	m_traceEvents.clear();
+	m_traceStart = Clock::now();
+	m_enabled = true;
+}
+
+void ecs::Profiler::stopTrace()
+{
+	if (m_tracePath.empty())
+	{
+		return;
+	}
+
+	std::ofstream stream{ m_tracePath, std::ios::trunc };
+
+	if (!stream)
+	{
+		throw Exception{ "Unable to open the trace file.", "ecs::Profiler::stopTrace()" };
+	}
+
+	// Complete events ("ph": "X"), on a single thread
+	stream << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+
+	for (std::size_t i{ 0 }; i < m_traceEvents.size(); ++i)
+	{
+		auto const &event{ m_traceEvents[i] };
+
+		stream << (i > 0 ? ",\n" : "\n") << "{\"name\":";
+		writeString(stream, m_sections[event.section].name);
+		stream << ",\"cat\":\"ecs\",\"ph\":\"X\",\"pid\":1,\"tid\":1"
+			<< ",\"ts\":" << toMicroseconds(event.start - m_traceStart)
+			<< ",\"dur\":" << toMicroseconds(event.duration)
+			<< ",\"args\":{\"entities\":" << event.entityCount;
+
+		auto const counters{ getCounters(event.counters) };
+
+		for (auto const &counter : { std::make_pair("cycles", counters.cycles), std::make_pair("instructions", counters.instructions),
+			std::make_pair("cache_misses", counters.cacheMisses), std::make_pair("branch_misses", counters.branchMisses) })
+		{
+			if (counter.second.has_value())
+			{
+				stream << ",\"" << counter.first << "\":" << counter.second.value();
+			}
+		}
+
+		stream << "}}";
+	}
+
+	stream << "\n]}\n";
+
+	m_tracePath.clear();
+	m_traceEvents.clear();
+
+	if (!stream.flush())
+	{
+		throw Exception{ "Unable to write the trace file.", "ecs::Profiler::stopTrace()" };
+	}
+}
+
+bool ecs::Profiler::isTracing() const noexcept
+{
+	return !m_tracePath.empty();
+}
+
+bool ecs::Profiler::enableCounters(bool enable)
+{
+	if (!enable)
+	{
+		m_counters.close();
+		return false;
+	}
+
+	return m_counters.open();
+}
+
+bool ecs::Profiler::countersEnabled() const noexcept
+{
+	return m_counters.isOpen();
+}
+
+void ecs::Profiler::addSystem(detail::TypeId systemId, char const *typeName)
+{
+	m_systemNames[systemId] = detail::demangle(typeName);
+}
+
+std::size_t ecs::Profiler::getSection(Step step, detail::TypeId systemId)
+{
+	auto const key{ (static_cast<std::uint64_t>(systemId) << 3) | static_cast<std::uint64_t>(step) };
+	auto const it{ m_sectionIds.find(key) };
+
+	if (it != m_sectionIds.end())
+	{
+		return it->second;
+	}
+
+	Section section;
+
+	switch (step)
+	{
+	case Step::Frame:
+		section.name = "ecs::World::update";
+		break;
+
+	case Step::UpdateEntities:
+		section.name = "ecs::World::updateEntities";
+		break;
+
+	default:
+	{
+		auto const name{ m_systemNames.find(systemId) };
+		section.name = name != m_systemNames.end() ? name->second : "System #" + std::to_string(systemId);
+
+		section.name += step == Step::Start ? "::onStart" : step == Step::Update ? "::onUpdate" : "::onPostUpdate";
+	}
+	}
+
+	section.samples.reserve(SAMPLE_COUNT);
+
+	m_sections.push_back(std::move(section));
+	m_sectionIds.emplace(key, m_sections.size() - 1);
+
+	return m_sections.size() - 1;
+}
+
+void ecs::Profiler::record(std::size_t section, Clock::time_point start, Clock::time_point end, std::size_t entityCount, std::optional<detail::PerfCounters::Values> const &before)
+{
+	auto &measures{ m_sections[section] };
+	auto const duration{ end - start };
+	auto const after{ m_counters.read() };
+
+	// A failed read is not a measure of 0 events: the sample is skipped
+	if (before.has_value() && after.has_value())
+	{
+		measures.counters.emplace();
+
+		for (std::size_t event{ 0 }; event < detail::PerfCounters::EVENT_COUNT; ++event)
+		{
+			(*measures.counters)[event] = (*after)[event] - (*before)[event];
+			measures.totalCounters[event] += (*measures.counters)[event];
+		}
+
+		++measures.counterCalls;
+	}
+	else
+	{
+		measures.counters.reset();
+	}
+
+	if (measures.samples.size() < SAMPLE_COUNT)
+	{
+		measures.samples.push_back(duration);
+	}
+	else
+	{
+		measures.samples[measures.calls % SAMPLE_COUNT] = duration;
+	}
+
+	++measures.calls;
+	measures.min = std::min(measures.min, duration);
+	measures.max = std::max(measures.max, duration);
+	measures.total += duration;
+	measures.entityCount = entityCount;
+
+	if (!m_tracePath.empty())
+	{
+		m_traceEvents.push_back(TraceEvent{ section, start, duration, entityCount, measures.counters });
+	}
+}
+
+ecs::Profiler::Counters ecs::Profiler::getCounters(std::optional<detail::PerfCounters::Values> const &values) const
+{
+	using detail::PerfCounters;
+
+	auto const get = [&](PerfCounters::Event event) -> std::optional<std::uint64_t>
+	{
+		if (!values.has_value() || !m_counters.isAvailable(event))
+		{
+			return std::nullopt;
+		}
+
+		return (*values)[event];
+	};
+
+	return Counters{ get(PerfCounters::Cycles), get(PerfCounters::Instructions), get(PerfCounters::CacheMisses), get(PerfCounters::BranchMisses) };
+}
@@ -0,0 +1,95 @@
+// Copyright (c) 2021 Ethan Margaillan <contact@ethan.jp>.
+// Licensed under the MIT License - https://raw.githubusercontent.com/Ethan13310/ECS/master/LICENSE
+
+#include <ECS/Detail/MemoryUsage.hpp>
+#include <ECS/Query.hpp>
+
+ecs::Query::Query(detail::ComponentFilter const &filter, std::pmr::memory_resource *resource) :
+	m_filter{ filter },
+	m_entities{ resource },
+	m_indices{ resource }
+{}
+
+std::pmr::vector<ecs::Entity> const &ecs::Query::getEntities() const noexcept
+{
+	return m_entities;
+}
+
+std::size_t ecs::Query::getEntityCount() const noexcept
+{
+	return m_entities.size();
+}
+
+bool ecs::Query::contains(Entity::Id id) const noexcept
+{
+	return id < m_indices.size() && m_indices[id] != npos;
+}
+
+ecs::detail::ComponentFilter const &ecs::Query::getFilter() const noexcept
+{
+	return m_filter;
+}
+
+void ecs::Query::insert(Entity const &entity)
+{
+	auto const id{ entity.getId() };
+
+	if (contains(id))
+	{
+		return;
+	}
+
+	if (id >= m_indices.size())
+	{
+		m_indices.resize(id + 1, npos);
+	}
+
+	m_indices[id] = m_entities.size();
+	m_entities.push_back(entity);
+}
+
+void ecs::Query::erase(Entity::Id id)
+{
+	if (!contains(id))
+	{
+		return;
+	}
+
+	auto const index{ m_indices[id] };
+
+	// The last Entity takes the place of the removed one
+	if (index != m_entities.size() - 1)
+	{
+		m_entities[index] = m_entities.back();
+		m_indices[m_entities[index].getId()] = index;
+	}
+
+	m_entities.pop_back();
+	m_indices[id] = npos;
+}
+
+void ecs::Query::clear() noexcept
+{
+	m_entities.clear();
+	m_indices.clear();
+}
+
+void ecs::Query::shrinkToFit(std::size_t size)
+{
+	if (m_indices.size() > size)
+	{
+		m_indices.resize(size);
+	}
+
+	m_entities.shrink_to_fit();
+	m_indices.shrink_to_fit();
+}
+
+ecs::MemoryUsage ecs::Query::getMemoryUsage() const noexcept
+{
+	auto memory{ detail::getMemoryUsage(m_entities) };
+
+	memory += detail::getMemoryUsage(m_indices);
+
+	return memory;
+}
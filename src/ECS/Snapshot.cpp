@@ -0,0 +1,876 @@
+// Copyright (c) 2021 Ethan Margaillan <contact@ethan.jp>.
+// Licensed under the MIT License - https://raw.githubusercontent.com/Ethan13310/ECS/master/LICENSE
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include <ECS/Detail/ComponentFilter.hpp>
+#include <ECS/Detail/NameTable.hpp>
+#include <ECS/Exceptions/Exception.hpp>
+#include <ECS/Exceptions/InvalidSnapshot.hpp>
+#include <ECS/Snapshot.hpp>
+#include <ECS/World.hpp>
+#include <ECS/WorldState.hpp>
+
+namespace
+{
+	// Snapshot file signature
+	constexpr char SNAPSHOT_MAGIC[4]{ 'E', 'C', 'S', 'S' };
+
+	// Delta file signature
+	constexpr char DELTA_MAGIC[4]{ 'E', 'C', 'S', 'D' };
+
+	// Entity flags
+	constexpr std::uint8_t ENTITY_VALID{ 1 << 0 };
+	constexpr std::uint8_t ENTITY_ENABLED{ 1 << 1 };
+	constexpr std::uint8_t ENTITY_NAMED{ 1 << 2 };
+
+	// Component column read from a snapshot
+	struct Column
+	{
+		// Description of the Component type
+		ecs::detail::ComponentInfo const *info{ nullptr };
+
+		// Entities owning the Components
+		std::vector<std::uint64_t> ids;
+
+		// Raw Component data, in the same order as the Entities
+		std::vector<unsigned char> data;
+	};
+
+	void writeBytes(std::ostream &stream, void const *data, std::size_t size)
+	{
+		stream.write(static_cast<char const*>(data), static_cast<std::streamsize>(size));
+	}
+
+	template <class T>
+	void writeValue(std::ostream &stream, T const &value)
+	{
+		writeBytes(stream, &value, sizeof(T));
+	}
+
+	void readBytes(std::istream &stream, void *data, std::size_t size)
+	{
+		if (!stream.read(static_cast<char*>(data), static_cast<std::streamsize>(size)))
+		{
+			// Unexpected end of stream
+			throw ecs::InvalidSnapshot{ "ecs::SnapshotReader::read()" };
+		}
+	}
+
+	template <class T>
+	T readValue(std::istream &stream)
+	{
+		T value{};
+		readBytes(stream, &value, sizeof(T));
+
+		return value;
+	}
+
+	// Get the number of bytes left in the stream, or the maximum value if the
+	// stream cannot tell
+	std::uint64_t getRemainingBytes(std::istream &stream)
+	{
+		auto const position{ stream.tellg() };
+
+		if (position == std::istream::pos_type(-1))
+		{
+			return std::numeric_limits<std::uint64_t>::max();
+		}
+
+		stream.seekg(0, std::ios::end);
+		auto const end{ stream.tellg() };
+		stream.seekg(position);
+
+		if (end == std::istream::pos_type(-1) || end < position)
+		{
+			stream.clear();
+			stream.seekg(position);
+
+			return std::numeric_limits<std::uint64_t>::max();
+		}
+
+		return static_cast<std::uint64_t>(end - position);
+	}
+
+	// Read a number of elements, each of which takes at least minSize bytes
+	// in the rest of the stream
+	// The number is checked before anything is allocated for the elements
+	template <class T>
+	std::uint64_t readCount(std::istream &stream, std::uint64_t minSize, char const *site)
+	{
+		auto const count{ static_cast<std::uint64_t>(readValue<T>(stream)) };
+
+		if (count > getRemainingBytes(stream) / minSize)
+		{
+			throw ecs::InvalidSnapshot{ site };
+		}
+
+		return count;
+	}
+
+	// Read count elements into a vector or a string
+	// The container grows as the data is read, so that a wrong count fails on
+	// the end of the stream before much memory is allocated, even when the
+	// stream cannot tell how many bytes are left
+	template <class Container>
+	void readArray(std::istream &stream, Container &array, std::uint64_t count, char const *site)
+	{
+		using Value = typename Container::value_type;
+
+		constexpr std::uint64_t chunk{ (1u << 16) / sizeof(Value) + 1 };
+
+		if (count > getRemainingBytes(stream) / sizeof(Value))
+		{
+			throw ecs::InvalidSnapshot{ site };
+		}
+
+		array.clear();
+
+		while (array.size() < count)
+		{
+			auto const first{ array.size() };
+			auto const size{ static_cast<std::size_t>(std::min(chunk, count - first)) };
+
+			array.resize(first + size);
+			readBytes(stream, array.data() + first, size * sizeof(Value));
+		}
+	}
+
+	// Check the signature and the version of a snapshot
+	void readHeader(std::istream &stream, char const (&signature)[4])
+	{
+		char magic[sizeof(signature)]{};
+		readBytes(stream, magic, sizeof(magic));
+
+		if (!std::equal(std::begin(magic), std::end(magic), std::begin(signature)) || readValue<std::uint32_t>(stream) != ecs::SNAPSHOT_VERSION)
+		{
+			throw ecs::InvalidSnapshot{ "ecs::SnapshotReader::read()" };
+		}
+	}
+
+	// Component type used by a delta
+	struct DeltaType
+	{
+		// Stable ID of the Component type
+		ecs::ComponentRegistry::StableId stableId;
+
+		// Description of the Component type, or nullptr if it is not registered
+		ecs::detail::ComponentInfo const *info;
+
+		// Size of the Component
+		std::uint64_t size;
+	};
+
+	// Component of a modified Entity read from a delta
+	struct DeltaComponent
+	{
+		// Index of the Component type in the list of types
+		std::uint32_t type;
+
+		// Offset of the Component data in the data buffer, if it has changed
+		std::optional<std::size_t> offset;
+	};
+
+	// Modified Entity read from a delta
+	struct DeltaEntity
+	{
+		// Entity ID
+		ecs::Entity::Id id;
+
+		// Entity flags
+		std::uint8_t flags;
+
+		// Entity name
+		std::string name;
+
+		// Components owned by the Entity
+		std::vector<DeltaComponent> components;
+	};
+}
+
+ecs::SnapshotWriter::SnapshotWriter(ComponentRegistry const &registry) :
+	m_registry{ registry }
+{}
+
+void ecs::SnapshotWriter::write(World const &world, std::ostream &stream) const
+{
+	writeBytes(stream, SNAPSHOT_MAGIC, sizeof(SNAPSHOT_MAGIC));
+	writeValue<std::uint32_t>(stream, SNAPSHOT_VERSION);
+
+	// Entity table
+	std::vector<std::uint8_t> flags(world.m_entities.size(), 0);
+
+	for (std::size_t id{ 0 }; id < world.m_entities.size(); ++id)
+	{
+		if (world.m_entities[id].isValid)
+		{
+			flags[id] |= ENTITY_VALID;
+
+			if (world.m_entities[id].isEnabled)
+			{
+				flags[id] |= ENTITY_ENABLED;
+			}
+		}
+	}
+
+	writeValue<std::uint64_t>(stream, flags.size());
+	writeBytes(stream, flags.data(), flags.size());
+
+	// Free Entity IDs, saved in order so that the IDs are reused the same way
+	auto const &storedIds{ world.m_pool.getStoredIds() };
+	std::vector<std::uint64_t> const freeIds(storedIds.begin(), storedIds.end());
+
+	writeValue<std::uint64_t>(stream, freeIds.size());
+	writeBytes(stream, freeIds.data(), freeIds.size() * sizeof(std::uint64_t));
+
+	// Entity names
+	writeValue<std::uint64_t>(stream, world.m_names.size());
+
+	world.m_names.forEach([&](Entity::Id id, std::string_view name)
+	{
+		writeValue<std::uint64_t>(stream, id);
+		writeValue<std::uint64_t>(stream, name.size());
+		writeBytes(stream, name.data(), name.size());
+	});
+
+	// Component columns
+	std::vector<std::pair<ComponentRegistry::StableId, detail::ComponentPool const*>> pools;
+
+	for (detail::TypeId typeId{ 0 }; typeId < MAX_COMPONENTS; ++typeId)
+	{
+		auto const pool{ world.m_components.getPool(typeId) };
+		auto const stableId{ m_registry->getStableId(typeId) };
+
+		if (pool != nullptr && pool->size() > 0 && stableId.has_value())
+		{
+			pools.emplace_back(stableId.value(), pool);
+		}
+	}
+
+	writeValue<std::uint32_t>(stream, static_cast<std::uint32_t>(pools.size()));
+
+	for (auto const &pool : pools)
+	{
+		auto const size{ pool.second->getInfo().size };
+
+		std::vector<std::uint64_t> ids;
+		std::vector<unsigned char> data(pool.second->size() * size);
+
+		ids.reserve(pool.second->size());
+
+		pool.second->forEach([&](Entity::Id id, void const *component)
+		{
+			std::memcpy(data.data() + ids.size() * size, component, size);
+			ids.push_back(id);
+		});
+
+		writeValue<std::uint32_t>(stream, pool.first);
+		writeValue<std::uint64_t>(stream, size);
+		writeValue<std::uint64_t>(stream, ids.size());
+		writeBytes(stream, ids.data(), ids.size() * sizeof(std::uint64_t));
+		writeBytes(stream, data.data(), data.size());
+	}
+
+	if (!stream)
+	{
+		throw Exception{ "Unable to write the snapshot.", "ecs::SnapshotWriter::write()" };
+	}
+}
+
+ecs::SnapshotReader::SnapshotReader(ComponentRegistry const &registry) :
+	m_registry{ registry }
+{}
+
+void ecs::SnapshotReader::read(World &world, std::istream &stream) const
+{
+	// The whole snapshot is read and checked before the World is modified
+	readHeader(stream, SNAPSHOT_MAGIC);
+
+	// Entity table
+	std::vector<std::uint8_t> flags;
+	readArray(stream, flags, readValue<std::uint64_t>(stream), "ecs::SnapshotReader::read()");
+
+	auto const isValid = [&](std::uint64_t id)
+	{
+		return id < flags.size() && (flags[id] & ENTITY_VALID) != 0;
+	};
+
+	// Free Entity IDs
+	std::vector<std::uint64_t> freeIds;
+	readArray(stream, freeIds, readValue<std::uint64_t>(stream), "ecs::SnapshotReader::read()");
+
+	for (auto const id : freeIds)
+	{
+		if (id >= flags.size() || isValid(id))
+		{
+			throw InvalidSnapshot{ "ecs::SnapshotReader::read()" };
+		}
+	}
+
+	// Entity names
+	// Each name takes its Entity ID and its length at least
+	auto const nameCount{ readCount<std::uint64_t>(stream, 16, "ecs::SnapshotReader::read()") };
+	detail::NameTable names;
+
+	for (std::uint64_t i{ 0 }; i < nameCount; ++i)
+	{
+		auto const id{ readValue<std::uint64_t>(stream) };
+		std::string name;
+		readArray(stream, name, readValue<std::uint64_t>(stream), "ecs::SnapshotReader::read()");
+
+		if (!isValid(id) || names.getName(id).has_value() || !names.insert(id, name))
+		{
+			// Unknown Entity or name already used
+			throw InvalidSnapshot{ "ecs::SnapshotReader::read()" };
+		}
+	}
+
+	// Component columns
+	// Each column takes its type, its Component size and its length at least
+	std::vector<Column> columns(readCount<std::uint32_t>(stream, 20, "ecs::SnapshotReader::read()"));
+	std::vector<detail::ComponentFilter::Mask> masks(flags.size());
+
+	for (auto &column : columns)
+	{
+		column.info = m_registry->getInfo(readValue<std::uint32_t>(stream));
+
+		auto const size{ readValue<std::uint64_t>(stream) };
+
+		readArray(stream, column.ids, readValue<std::uint64_t>(stream), "ecs::SnapshotReader::read()");
+
+		if (size != 0 && column.ids.size() > getRemainingBytes(stream) / size)
+		{
+			throw InvalidSnapshot{ "ecs::SnapshotReader::read()" };
+		}
+
+		readArray(stream, column.data, column.ids.size() * size, "ecs::SnapshotReader::read()");
+
+		if (column.info == nullptr)
+		{
+			// Unregistered Component type, the column is skipped
+			continue;
+		}
+
+		if (column.info->size != size || column.info->typeId >= MAX_COMPONENTS)
+		{
+			throw InvalidSnapshot{ "ecs::SnapshotReader::read()" };
+		}
+
+		for (auto const id : column.ids)
+		{
+			// An Entity cannot own the same Component twice
+			if (!isValid(id) || masks[id][column.info->typeId])
+			{
+				throw InvalidSnapshot{ "ecs::SnapshotReader::read()" };
+			}
+
+			masks[id].set(column.info->typeId);
+		}
+	}
+
+	// Replace the content of the World
+	world.resetEntities();
+	world.extend(flags.size());
+
+	for (std::size_t id{ 0 }; id < flags.size(); ++id)
+	{
+		auto &attributes{ world.m_entities[id] };
+
+		attributes.entity = Entity{ id, world };
+		attributes.isValid = (flags[id] & ENTITY_VALID) != 0;
+		attributes.isEnabled = attributes.isValid && (flags[id] & ENTITY_ENABLED) != 0;
+		attributes.isDisabled = attributes.isValid && !attributes.isEnabled;
+
+		world.markChanged(id);
+	}
+
+	world.m_pool.restore(flags.size(), std::vector<Entity::Id>(freeIds.begin(), freeIds.end()));
+
+	world.m_names = std::move(names);
+
+	// Components are copied column by column into storage allocated at once
+	for (auto const &column : columns)
+	{
+		if (column.info == nullptr)
+		{
+			continue;
+		}
+
+		auto &pool{ world.m_components.getOrCreatePool(*column.info) };
+		auto const size{ column.info->size };
+
+		pool.reserve(pool.size() + column.ids.size());
+
+		for (std::size_t i{ 0 }; i < column.ids.size(); ++i)
+		{
+			std::memcpy(pool.assign(column.ids[i]), column.data.data() + i * size, size);
+		}
+	}
+
+	// The Entities will be attached to the Systems on the next update
+	world.m_actions.reserve(flags.size());
+
+	for (std::size_t id{ 0 }; id < flags.size(); ++id)
+	{
+		if (world.m_entities[id].isValid)
+		{
+			world.m_components.setComponentsMask(id, masks[id]);
+			world.refreshEntity(id);
+		}
+	}
+}
+
+ecs::DeltaWriter::DeltaWriter(ComponentRegistry const &registry) :
+	m_registry{ registry }
+{}
+
+void ecs::DeltaWriter::write(World const &world, WorldState const &baseline, std::ostream &stream) const
+{
+	if (baseline.m_worldId != world.m_instanceId.getValue())
+	{
+		throw Exception{ "Baseline has not been saved from this World.", "ecs::DeltaWriter::write()" };
+	}
+
+	if (baseline.m_version < world.m_resetVersion)
+	{
+		throw Exception{ "Baseline has been saved before the Entities have been reset.", "ecs::DeltaWriter::write()" };
+	}
+
+	auto const &entities{ world.m_entities };
+	auto const &baseEntities{ baseline.m_entities };
+
+	auto const wasValid = [&](Entity::Id id)
+	{
+		return id < baseEntities.size() && baseEntities[id].isValid;
+	};
+
+	// Registered Component types, either in the World or in the baseline
+	struct Pools
+	{
+		ComponentRegistry::StableId stableId;
+		detail::ComponentPool const *current;
+		detail::ComponentPool const *baseline;
+	};
+
+	std::vector<Pools> pools;
+
+	for (detail::TypeId typeId{ 0 }; typeId < MAX_COMPONENTS; ++typeId)
+	{
+		auto const current{ world.m_components.getPool(typeId) };
+		auto const previous{ baseline.m_components.getPool(typeId) };
+		auto const stableId{ m_registry->getStableId(typeId) };
+
+		if ((current != nullptr || previous != nullptr) && stableId.has_value())
+		{
+			pools.push_back({ stableId.value(), current, previous });
+		}
+	}
+
+	// Entities modified since the baseline has been saved
+	std::vector<Entity::Id> ids;
+
+	auto const first{ std::partition_point(world.m_changes.begin(), world.m_changes.end(), [&](World::EntityChange const &change)
+	{
+		return change.version <= baseline.m_version;
+	}) };
+
+	for (auto it{ first }; it != world.m_changes.end(); ++it)
+	{
+		// Only the last modification of an Entity is relevant
+		if (it->id < entities.size() && entities[it->id].version == it->version)
+		{
+			ids.push_back(it->id);
+		}
+	}
+
+	// Entities which do not exist anymore
+	for (auto id{ entities.size() }; id < baseEntities.size(); ++id)
+	{
+		if (wasValid(id))
+		{
+			ids.push_back(id);
+		}
+	}
+
+	// Modified Entities are written into a buffer first, since the Entities
+	// which turn out to be identical to the baseline are skipped
+	std::ostringstream records;
+	std::uint64_t recordCount{ 0 };
+
+	std::vector<std::pair<std::uint32_t, void const*>> components;
+
+	for (auto const id : ids)
+	{
+		if (id >= entities.size() || !entities[id].isValid)
+		{
+			if (wasValid(id))
+			{
+				// Removed Entity
+				writeValue<std::uint64_t>(records, id);
+				writeValue<std::uint8_t>(records, 0);
+				++recordCount;
+			}
+
+			continue;
+		}
+
+		auto const &attributes{ entities[id] };
+		auto const name{ world.m_names.getName(id) };
+
+		std::uint8_t flags{ ENTITY_VALID };
+		flags |= attributes.isEnabled ? ENTITY_ENABLED : 0;
+		flags |= name.has_value() ? ENTITY_NAMED : 0;
+
+		auto identical{ wasValid(id) && baseEntities[id].isEnabled == attributes.isEnabled && baseline.m_names.getName(id) == name };
+
+		components.clear();
+
+		for (std::uint32_t type{ 0 }; type < pools.size(); ++type)
+		{
+			auto const &pool{ pools[type] };
+
+			auto const current{ pool.current != nullptr ? pool.current->get(id) : nullptr };
+			auto const previous{ pool.baseline != nullptr && wasValid(id) ? pool.baseline->get(id) : nullptr };
+
+			if (current != nullptr)
+			{
+				auto const changed{ previous == nullptr || std::memcmp(current, previous, pool.current->getInfo().size) != 0 };
+
+				components.emplace_back(type, changed ? current : nullptr);
+				identical = identical && !changed;
+			}
+			else if (previous != nullptr)
+			{
+				// Removed Component
+				identical = false;
+			}
+		}
+
+		if (identical)
+		{
+			continue;
+		}
+
+		writeValue<std::uint64_t>(records, id);
+		writeValue<std::uint8_t>(records, flags);
+
+		if (name.has_value())
+		{
+			writeValue<std::uint64_t>(records, name->size());
+			writeBytes(records, name->data(), name->size());
+		}
+
+		writeValue<std::uint32_t>(records, static_cast<std::uint32_t>(components.size()));
+
+		for (auto const &component : components)
+		{
+			writeValue<std::uint32_t>(records, component.first);
+			writeValue<std::uint8_t>(records, component.second != nullptr ? 1 : 0);
+
+			if (component.second != nullptr)
+			{
+				auto const &pool{ pools[component.first] };
+				writeBytes(records, component.second, pool.current->getInfo().size);
+			}
+		}
+
+		++recordCount;
+	}
+
+	writeBytes(stream, DELTA_MAGIC, sizeof(DELTA_MAGIC));
+	writeValue<std::uint32_t>(stream, SNAPSHOT_VERSION);
+	writeValue<std::uint64_t>(stream, entities.size());
+
+	// Free Entity IDs, only if they have changed
+	auto const &storedIds{ world.m_pool.getStoredIds() };
+
+	if (std::equal(storedIds.begin(), storedIds.end(), baseline.m_storedIds.begin(), baseline.m_storedIds.end()))
+	{
+		writeValue<std::uint8_t>(stream, 0);
+	}
+	else
+	{
+		std::vector<std::uint64_t> const freeIds(storedIds.begin(), storedIds.end());
+
+		writeValue<std::uint8_t>(stream, 1);
+		writeValue<std::uint64_t>(stream, freeIds.size());
+		writeBytes(stream, freeIds.data(), freeIds.size() * sizeof(std::uint64_t));
+	}
+
+	// Component types
+	writeValue<std::uint32_t>(stream, static_cast<std::uint32_t>(pools.size()));
+
+	for (auto const &pool : pools)
+	{
+		auto const &info{ pool.current != nullptr ? pool.current->getInfo() : pool.baseline->getInfo() };
+
+		writeValue<std::uint32_t>(stream, pool.stableId);
+		writeValue<std::uint64_t>(stream, info.size);
+	}
+
+	// Modified Entities
+	auto const data{ records.str() };
+
+	writeValue<std::uint64_t>(stream, recordCount);
+	writeBytes(stream, data.data(), data.size());
+
+	if (!stream)
+	{
+		throw Exception{ "Unable to write the delta.", "ecs::DeltaWriter::write()" };
+	}
+}
+
+ecs::DeltaReader::DeltaReader(ComponentRegistry const &registry) :
+	m_registry{ registry }
+{}
+
+void ecs::DeltaReader::apply(World &world, std::istream &stream) const
+{
+	// The whole delta is read and checked before the World is modified
+	readHeader(stream, DELTA_MAGIC);
+
+	auto const size{ readValue<std::uint64_t>(stream) };
+
+	// Free Entity IDs
+	std::optional<std::vector<Entity::Id>> freeIds;
+
+	if (readValue<std::uint8_t>(stream) != 0)
+	{
+		std::vector<std::uint64_t> ids;
+		readArray(stream, ids, readValue<std::uint64_t>(stream), "ecs::DeltaReader::apply()");
+
+		freeIds.emplace(ids.begin(), ids.end());
+	}
+
+	// Component types
+	// Each type takes its stable ID and its size
+	std::vector<DeltaType> types(readCount<std::uint32_t>(stream, 12, "ecs::DeltaReader::apply()"));
+
+	for (auto &type : types)
+	{
+		type.stableId = readValue<std::uint32_t>(stream);
+		type.size = readValue<std::uint64_t>(stream);
+		type.info = m_registry->getInfo(type.stableId);
+
+		if ((type.info != nullptr && (type.info->size != type.size || type.info->typeId >= MAX_COMPONENTS)) || type.size > getRemainingBytes(stream))
+		{
+			throw InvalidSnapshot{ "ecs::DeltaReader::apply()" };
+		}
+	}
+
+	// Modified Entities
+	// Each record takes its Entity ID and its flags at least
+	std::vector<DeltaEntity> records(readCount<std::uint64_t>(stream, 9, "ecs::DeltaReader::apply()"));
+	std::vector<unsigned char> data;
+
+	std::unordered_set<Entity::Id> recordIds;
+
+	for (auto &record : records)
+	{
+		record.id = readValue<std::uint64_t>(stream);
+		record.flags = readValue<std::uint8_t>(stream);
+
+		// Removed Entities may be beyond the end of the Entity table
+		auto const isValid{ (record.flags & ENTITY_VALID) != 0 };
+
+		if ((isValid && record.id >= size) || !recordIds.insert(record.id).second)
+		{
+			throw InvalidSnapshot{ "ecs::DeltaReader::apply()" };
+		}
+
+		if (!isValid)
+		{
+			continue;
+		}
+
+		if ((record.flags & ENTITY_NAMED) != 0)
+		{
+			readArray(stream, record.name, readValue<std::uint64_t>(stream), "ecs::DeltaReader::apply()");
+		}
+
+		// Each Component takes its type and whether it has changed
+		record.components.resize(readCount<std::uint32_t>(stream, 5, "ecs::DeltaReader::apply()"));
+
+		for (auto &component : record.components)
+		{
+			component.type = readValue<std::uint32_t>(stream);
+
+			if (component.type >= types.size())
+			{
+				throw InvalidSnapshot{ "ecs::DeltaReader::apply()" };
+			}
+
+			auto const &type{ types[component.type] };
+
+			if (readValue<std::uint8_t>(stream) != 0)
+			{
+				component.offset = data.size();
+
+				data.resize(data.size() + type.size);
+				readBytes(stream, data.data() + component.offset.value(), type.size);
+			}
+			else if (type.info != nullptr && !world.m_components.getComponentsMask(record.id).test(type.info->typeId))
+			{
+				// An unchanged Component must already exist
+				throw InvalidSnapshot{ "ecs::DeltaReader::apply()" };
+			}
+		}
+	}
+
+	// Check the names: a name must not be used by an Entity left untouched
+	std::unordered_set<std::string> names;
+
+	for (auto const &record : records)
+	{
+		if ((record.flags & ENTITY_NAMED) == 0)
+		{
+			continue;
+		}
+
+		auto const owner{ world.m_names.find(record.name) };
+
+		if (!names.insert(record.name).second || (owner.has_value() && recordIds.find(owner.value()) == recordIds.end()))
+		{
+			throw InvalidSnapshot{ "ecs::DeltaReader::apply()" };
+		}
+	}
+
+	// Check the free IDs: they must not be used by valid Entities
+	if (freeIds.has_value())
+	{
+		std::unordered_map<Entity::Id, std::uint8_t> flags;
+
+		for (auto const &record : records)
+		{
+			flags[record.id] = record.flags;
+		}
+
+		for (auto const id : freeIds.value())
+		{
+			auto const it{ flags.find(id) };
+			auto const isValid{ it != flags.end() ? (it->second & ENTITY_VALID) != 0 : world.isEntityValid(id) };
+
+			if (id >= size || isValid)
+			{
+				throw InvalidSnapshot{ "ecs::DeltaReader::apply()" };
+			}
+		}
+	}
+
+	// Removed Entities are detached from their Systems right away
+	auto const &poolIds{ world.m_pool.getStoredIds() };
+	std::vector<Entity::Id> const storedIds(poolIds.begin(), poolIds.end());
+
+	world.extend(size);
+
+	for (auto const &record : records)
+	{
+		if (record.id >= world.m_entities.size())
+		{
+			continue;
+		}
+
+		auto &attributes{ world.m_entities[record.id] };
+
+		if ((record.flags & ENTITY_VALID) == 0)
+		{
+			if (attributes.isValid)
+			{
+				world.actionRemove(record.id);
+				world.markChanged(record.id);
+			}
+		}
+		else
+		{
+			// The names are given back once all the old names are released
+			world.m_names.erase(record.id);
+		}
+	}
+
+	for (auto const &record : records)
+	{
+		if ((record.flags & ENTITY_VALID) == 0)
+		{
+			continue;
+		}
+
+		auto &attributes{ world.m_entities[record.id] };
+		auto const wasValid{ attributes.isValid };
+		auto const wasEnabled{ attributes.isEnabled };
+
+		if (!wasValid)
+		{
+			attributes.entity = Entity{ record.id, world };
+			attributes.isValid = true;
+		}
+
+		attributes.isEnabled = (record.flags & ENTITY_ENABLED) != 0;
+		attributes.isDisabled = !attributes.isEnabled;
+
+		if ((record.flags & ENTITY_NAMED) != 0)
+		{
+			world.m_names.insert(record.id, record.name);
+		}
+
+		// Components which are not in the delta anymore are removed
+		auto mask{ world.m_components.getComponentsMask(record.id) };
+
+		for (auto const &type : types)
+		{
+			auto const owned{ std::any_of(record.components.begin(), record.components.end(), [&](DeltaComponent const &component)
+			{
+				return &types[component.type] == &type;
+			}) };
+
+			if (type.info != nullptr && !owned && mask.test(type.info->typeId))
+			{
+				world.m_components.getPool(type.info->typeId)->remove(record.id);
+				mask.reset(type.info->typeId);
+			}
+		}
+
+		for (auto const &component : record.components)
+		{
+			auto const &type{ types[component.type] };
+
+			if (type.info != nullptr && component.offset.has_value())
+			{
+				auto &pool{ world.m_components.getOrCreatePool(*type.info) };
+				auto const dst{ pool.has(record.id) ? pool.get(record.id) : pool.assign(record.id) };
+
+				std::memcpy(dst, data.data() + component.offset.value(), type.size);
+				mask.set(type.info->typeId);
+			}
+		}
+
+		world.m_components.setComponentsMask(record.id, mask);
+		world.markChanged(record.id);
+
+		// The Systems are updated on the next update of the World
+		world.refreshEntity(record.id);
+
+		if (wasValid && wasEnabled != attributes.isEnabled)
+		{
+			if (attributes.isEnabled)
+			{
+				world.enableEntity(record.id);
+			}
+			else
+			{
+				world.disableEntity(record.id);
+			}
+		}
+	}
+
+	world.m_pool.restore(size, freeIds.value_or(storedIds));
+}
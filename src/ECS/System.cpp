@@ -2,7 +2,10 @@
 // Licensed under the MIT License - https://raw.githubusercontent.com/Ethan13310/ECS/master/LICENSE
 
 #include <algorithm>
+#include <memory>
+#include <new>
 
+#include <ECS/Detail/MemoryUsage.hpp>
 #include <ECS/Exceptions/Exception.hpp>
 #include <ECS/System.hpp>
 #include <ECS/World.hpp>
@@ -34,6 +37,23 @@ void ecs::System::detachAll()
 	m_status.clear();
 }
 
+void ecs::System::setMemoryResource(std::pmr::memory_resource *resource)
+{
+	// Assigning a container keeps its allocator, so the empty containers
+	// are constructed again with the new resource
+	std::destroy_at(&m_enabledEntities);
+	new (&m_enabledEntities) std::pmr::vector<Entity>{ resource };
+
+	std::destroy_at(&m_disabledEntities);
+	new (&m_disabledEntities) std::pmr::vector<Entity>{ resource };
+
+	std::destroy_at(&m_status);
+	new (&m_status) std::pmr::unordered_map<Entity::Id, EntityStatus>{ resource };
+
+	std::destroy_at(&m_events);
+	new (&m_events) std::pmr::unordered_set<std::size_t>{ resource };
+}
+
 void ecs::System::attachEntity(Entity const &entity)
 {
 	if (getEntityStatus(entity) == EntityStatus::NotAttached)
@@ -47,6 +67,32 @@ void ecs::System::attachEntity(Entity const &entity)
 	}
 }
 
+void ecs::System::attachNewEntity(Entity const &entity, bool enabled)
+{
+	if (enabled)
+	{
+		m_enabledEntities.push_back(entity);
+
+		attachEvent(entity);
+		enableEvent(entity);
+		setEntityStatus(entity, EntityStatus::Enabled);
+	}
+	else
+	{
+		m_disabledEntities.push_back(entity);
+
+		attachEvent(entity);
+		setEntityStatus(entity, EntityStatus::Disabled);
+	}
+}
+
+void ecs::System::reserve(std::size_t enabled, std::size_t disabled)
+{
+	m_enabledEntities.reserve(m_enabledEntities.size() + enabled);
+	m_disabledEntities.reserve(m_disabledEntities.size() + disabled);
+	m_status.reserve(m_status.size() + enabled + disabled);
+}
+
 void ecs::System::detachEntity(Entity const &entity)
 {
 	auto const status{ getEntityStatus(entity) };
@@ -140,7 +186,7 @@ void ecs::System::disableEvent(Entity const &entity)
 	callEvent(std::bind(&System::onEntityDisabled, this, entity));
 }
 
-std::vector<ecs::Entity> const &ecs::System::getEntities() const
+std::pmr::vector<ecs::Entity> const &ecs::System::getEntities() const
 {
 	return m_enabledEntities;
 }
@@ -243,3 +289,37 @@ void ecs::System::setEntityStatus(Entity::Id id, EntityStatus status)
 		m_status[id] = status;
 	}
 }
+
+void ecs::System::saveState(State &state) const
+{
+	state.enabledEntities = m_enabledEntities;
+	state.disabledEntities = m_disabledEntities;
+	state.status = m_status;
+}
+
+void ecs::System::restoreState(State const &state)
+{
+	m_enabledEntities = state.enabledEntities;
+	m_disabledEntities = state.disabledEntities;
+	m_status = state.status;
+}
+
+void ecs::System::shrinkToFit()
+{
+	m_enabledEntities.shrink_to_fit();
+	m_disabledEntities.shrink_to_fit();
+
+	m_status.rehash(0);
+	m_events.rehash(0);
+}
+
+ecs::MemoryUsage ecs::System::getMemoryUsage() const noexcept
+{
+	auto memory{ detail::getMemoryUsage(m_enabledEntities) };
+
+	memory += detail::getMemoryUsage(m_disabledEntities);
+	memory += detail::getNodeMemoryUsage(m_status);
+	memory += detail::getNodeMemoryUsage(m_events);
+
+	return memory;
+}
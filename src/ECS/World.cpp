@@ -1,16 +1,42 @@
 // Copyright (c) 2021 Ethan Margaillan <contact@ethan.jp>.
 // Licensed under the MIT License - https://raw.githubusercontent.com/Ethan13310/ECS/master/LICENSE
 
+#include <algorithm>
 #include <stdexcept>
+#include <system_error>
+#include <thread>
+#include <utility>
 
+#include <ECS/Detail/MemoryUsage.hpp>
 #include <ECS/Entity.hpp>
+#include <ECS/ErrorReport.hpp>
 #include <ECS/Exceptions/Exception.hpp>
 #include <ECS/Exceptions/InvalidEntity.hpp>
-#include <ECS/Log.hpp>
 #include <ECS/World.hpp>
+#include <ECS/WorldState.hpp>
 #include <ECS/Entity.inl>
 #include <ECS/World.inl>
 
+ecs::World::World() :
+	World{ std::pmr::get_default_resource() }
+{}
+
+ecs::World::World(std::pmr::memory_resource *resource) :
+	m_entities{ resource },
+	m_actions{ resource },
+	m_processedActions{ resource },
+	m_changes{ resource },
+	m_names{ resource },
+	m_components{ resource },
+	m_errorReport{ std::make_unique<ErrorReport>() },
+	m_systems{ *m_errorReport, resource },
+	m_queries{ resource },
+	m_newSystems{ resource },
+	m_pool{ resource },
+	m_evtDispatcher{ resource },
+	m_frameArena{ std::make_unique<detail::FrameArena>(resource) }
+{}
+
 ecs::World::~World()
 {
 	clear();
@@ -34,23 +60,26 @@ ecs::Entity ecs::World::createEntity()
 	// Attributes
 	m_entities[id].isValid = true;
 	m_entities[id].isEnabled = true;
+	m_entities[id].isDisabled = false;
+
+	++m_frameStats.entitiesCreated;
+	++m_frameStats.entitiesEnabled;
 
 	enableEntity(m_entities[id].entity);
 
 	return m_entities[id].entity;
 }
 
-ecs::Entity ecs::World::createEntity(std::string const &name)
+ecs::Entity ecs::World::createEntity(std::string_view name)
 {
-	if (m_names.find(name) != m_names.end())
+	if (m_names.find(name).has_value())
 	{
 		throw Exception{ "Entity name already used.", "ecs::World::createEntity()" };
 	}
 
 	auto const entity{ createEntity() };
 
-	m_names[name] = entity.getId();
-	m_entities[entity.getId()].name = name;
+	m_names.insert(entity.getId(), name);
 
 	return entity;
 }
@@ -65,16 +94,21 @@ std::optional<ecs::Entity> ecs::World::getEntity(Entity::Id id) const
 	return m_entities[id].entity;
 }
 
-std::optional<ecs::Entity> ecs::World::getEntity(std::string const &name) const
+std::optional<ecs::Entity> ecs::World::getEntity(std::string_view name) const
+{
+	return getEntity(HashedName{ name });
+}
+
+std::optional<ecs::Entity> ecs::World::getEntity(HashedName const &name) const
 {
-	auto const it{ m_names.find(name) };
+	auto const id{ m_names.find(name) };
 
-	if (it == m_names.end())
+	if (!id.has_value())
 	{
 		return std::nullopt;
 	}
 
-	return getEntity(it->second);
+	return getEntity(id.value());
 }
 
 std::string ecs::World::getEntityName(Entity::Id id) const
@@ -84,9 +118,11 @@ std::string ecs::World::getEntityName(Entity::Id id) const
 		throw InvalidEntity{ "ecs::World::getEntityName()" };
 	}
 
-	if (m_entities[id].name.has_value())
+	auto const name{ m_names.getName(id) };
+
+	if (name.has_value())
 	{
-		return m_entities[id].name.value();
+		return std::string{ name.value() };
 	}
 
 	return {};
@@ -99,6 +135,8 @@ void ecs::World::enableEntity(Entity::Id id)
 		throw InvalidEntity{ "ecs::World::enableEntity()" };
 	}
 
+	markChanged(id);
+
 	m_actions.push_back({ id, EntityAction::Action::Enable });
 }
 
@@ -109,6 +147,8 @@ void ecs::World::disableEntity(Entity::Id id)
 		throw InvalidEntity{ "ecs::World::disableEntity()" };
 	}
 
+	markChanged(id);
+
 	m_actions.push_back({ id, EntityAction::Action::Disable });
 }
 
@@ -119,9 +159,51 @@ void ecs::World::refreshEntity(Entity::Id id)
 		throw InvalidEntity{ "ecs::World::refreshEntity()" };
 	}
 
+	markChanged(id);
+
 	m_actions.push_back({ id, EntityAction::Action::Refresh });
 }
 
+void ecs::World::countRemovedComponents(Entity::Id id)
+{
+	auto const mask{ m_components.getComponentsMask(id) };
+
+	for (detail::TypeId typeId{ 0 }; typeId < MAX_COMPONENTS; ++typeId)
+	{
+		if (mask.test(typeId))
+		{
+			++m_frameStats.componentsRemoved[typeId];
+		}
+	}
+}
+
+void ecs::World::markChanged(Entity::Id id)
+{
+	if (id >= m_entities.size() || m_entities[id].version == m_version)
+	{
+		// Already modified since the last save
+		return;
+	}
+
+	// Drop the outdated modifications once the list gets too long
+	if (m_changes.size() >= 2 * m_entities.size() + 64)
+	{
+		pruneChanges();
+	}
+
+	m_entities[id].version = m_version;
+	m_changes.push_back({ m_version, id });
+}
+
+void ecs::World::pruneChanges()
+{
+	// Only the last modification of each Entity is kept
+	m_changes.erase(std::remove_if(m_changes.begin(), m_changes.end(), [&](EntityChange const &change)
+	{
+		return change.id >= m_entities.size() || m_entities[change.id].version != change.version;
+	}), m_changes.end());
+}
+
 bool ecs::World::isEntityEnabled(Entity::Id id) const
 {
 	return isEntityValid(id) && m_entities[id].isEnabled;
@@ -134,6 +216,8 @@ void ecs::World::removeEntity(Entity::Id id)
 		throw InvalidEntity{ "ecs::World::removeEntity()" };
 	}
 
+	markChanged(id);
+
 	m_actions.push_back({ id, EntityAction::Action::Remove });
 }
 
@@ -154,58 +238,356 @@ bool ecs::World::isEntityValid(Entity::Id id) const
 	return id < m_entities.size() && m_entities[id].isValid;
 }
 
+ecs::Query &ecs::World::query(detail::ComponentFilter const &filter)
+{
+	for (auto const &query : m_queries)
+	{
+		if (query->getFilter() == filter)
+		{
+			return *query;
+		}
+	}
+
+	m_queries.push_back(std::make_unique<Query>(filter, getMemoryResource()));
+	populateQuery(*m_queries.back());
+
+	return *m_queries.back();
+}
+
 void ecs::World::update(float elapsed)
 {
-	// Start new Systems
-	for (auto &system : m_newSystems)
+	m_profiler.measure(Profiler::Step::Frame, 0, nullptr, [&]
+	{
+		// Start new Systems
+		for (auto &system : m_newSystems)
+		{
+			m_profiler.measure(Profiler::Step::Start, system.second, &system.first.get(), [&]
+			{
+				system.first->startEvent();
+				attachExistingEntities(system.first.get(), system.second);
+			});
+		}
+
+		m_newSystems.clear();
+
+		updateSystems([&](System &system, detail::TypeId systemId)
+		{
+			if (system.m_pipelined > 0)
+			{
+				return;
+			}
+
+			m_profiler.measure(Profiler::Step::Update, systemId, &system, [&]
+			{
+				system.updateEvent(elapsed);
+			});
+		});
+
+		updateSystems([&](System &system, detail::TypeId systemId)
+		{
+			if (system.m_pipelined > 0)
+			{
+				return;
+			}
+
+			m_profiler.measure(Profiler::Step::PostUpdate, systemId, &system, [&]
+			{
+				system.postUpdateEvent(elapsed);
+			});
+		});
+	});
+
+	// Repeated errors are logged once per window
+	m_errorReport->endFrame();
+
+	// The counters of the current frame become those of the last frame
+	auto const &emitCounts{ m_evtDispatcher.getEmitCounts() };
+
+	m_frameStats.eventsEmitted.assign(emitCounts.begin(), emitCounts.end());
+	m_evtDispatcher.resetEmitCounts();
+
+	std::swap(m_frameStats, m_lastFrameStats);
+	m_frameStats.reset();
+
+	// The temporary allocations of the frame are released at once
+	m_frameArena->reset();
+}
+
+void ecs::World::clear()
+{
+	removeAllSystems();
+
+	m_evtDispatcher.clearAll();
+
+	resetEntities();
+}
+
+void ecs::World::shrinkToFit()
+{
+	// The removed Entities at the end of the table are trimmed
+	auto size{ m_entities.size() };
+
+	while (size > 0 && !m_entities[size - 1].isValid)
 	{
-		system->startEvent();
+		--size;
 	}
 
-	m_newSystems.clear();
+	m_entities.resize(size);
+	m_entities.shrink_to_fit();
 
-	updateSystems([elapsed](System &system, detail::TypeId)
+	// Delta snapshots find the trimmed Entities by comparing the table sizes,
+	// so their modifications are not needed anymore
+	pruneChanges();
+	m_changes.shrink_to_fit();
+
+	for (auto &attributes : m_entities)
 	{
-		system.updateEvent(elapsed);
+		attributes.systems.shrink_to_fit();
+	}
+
+	m_actions.shrink_to_fit();
+	m_processedActions.clear();
+	m_processedActions.shrink_to_fit();
+	m_newSystems.shrink_to_fit();
+
+	m_components.shrinkToFit(size);
+	m_pool.shrinkToFit(size);
+	m_names.shrinkToFit();
+
+	m_systems.forEach([](System &system, detail::TypeId)
+	{
+		system.shrinkToFit();
+	});
+
+	for (auto const &query : m_queries)
+	{
+		query->shrinkToFit(size);
+	}
+
+	m_queries.shrink_to_fit();
+	m_evtDispatcher.shrinkToFit();
+	m_frameArena->release();
+}
+
+void ecs::World::setAttachThreadCount(std::size_t count) noexcept
+{
+	m_attachThreadCount = count;
+}
+
+std::pmr::memory_resource *ecs::World::getMemoryResource() const noexcept
+{
+	return m_entities.get_allocator().resource();
+}
+
+std::pmr::memory_resource &ecs::World::getFrameResource() noexcept
+{
+	return *m_frameArena;
+}
+
+ecs::Profiler &ecs::World::getProfiler() noexcept
+{
+	return m_profiler;
+}
+
+ecs::Profiler const &ecs::World::getProfiler() const noexcept
+{
+	return m_profiler;
+}
+
+ecs::ErrorReport &ecs::World::getErrorReport() noexcept
+{
+	return *m_errorReport;
+}
+
+ecs::ErrorReport const &ecs::World::getErrorReport() const noexcept
+{
+	return *m_errorReport;
+}
+
+ecs::FrameStats const &ecs::World::getFrameStats() const noexcept
+{
+	return m_lastFrameStats;
+}
+
+ecs::MemoryStats ecs::World::memoryStats() const
+{
+	MemoryStats stats;
+
+	stats.entities = detail::getMemoryUsage(m_entities);
+
+	for (auto const &attributes : m_entities)
+	{
+		stats.entities += detail::getMemoryUsage(attributes.systems);
+	}
+
+	stats.actions = detail::getMemoryUsage(m_actions);
+	stats.actions += detail::getMemoryUsage(m_processedActions);
+	stats.actions += detail::getMemoryUsage(m_changes);
+	stats.actions += detail::getMemoryUsage(m_newSystems);
+
+	stats.entityIds = m_pool.getMemoryUsage();
+	stats.componentMasks = m_components.getMasksMemoryUsage();
+
+	for (detail::TypeId typeId{ 0 }; typeId < MAX_COMPONENTS; ++typeId)
+	{
+		auto const pool{ m_components.getPool(typeId) };
+
+		if (pool != nullptr)
+		{
+			stats.components.push_back(MemoryStats::Component{ typeId, pool->size(), pool->getMemoryUsage() });
+		}
+	}
+
+	m_systems.forEach([&](System const &system, detail::TypeId systemId)
+	{
+		MemoryStats::System stat;
+		stat.typeId = systemId;
+		stat.name = m_systems.getSystemName(systemId);
+		stat.entityCount = system.getEntityCount();
+		stat.memory = system.getMemoryUsage();
+
+		stats.systems.push_back(std::move(stat));
 	});
 
-	updateSystems([elapsed](System &system, detail::TypeId)
+	for (auto const &query : m_queries)
+	{
+		stats.queries += query->getMemoryUsage();
+	}
+
+	stats.queries += detail::getMemoryUsage(m_queries);
+	stats.names = m_names.getMemoryUsage();
+	stats.events = m_evtDispatcher.getMemoryUsage();
+	stats.frameArena = m_frameArena->getMemoryUsage();
+
+	return stats;
+}
+
+void ecs::World::saveState(WorldState &state) const
+{
+	state.m_worldId = m_instanceId.getValue();
+	state.m_version = m_version++;
+	state.m_changes = m_changes;
+
+	state.m_entities = m_entities;
+	state.m_actions = m_actions;
+	state.m_names = m_names;
+	state.m_components.copyFrom(m_components);
+	state.m_storedIds.assign(m_pool.getStoredIds().begin(), m_pool.getStoredIds().end());
+	state.m_nextId = m_pool.getNextId();
+
+	// Systems which have been removed since the last save are forgotten
+	for (auto it{ state.m_systems.begin() }; it != state.m_systems.end();)
+	{
+		if (!m_systems.hasSystem(it->first))
+		{
+			it = state.m_systems.erase(it);
+		}
+		else
+		{
+			++it;
+		}
+	}
+
+	m_systems.forEach([&](System const &system, detail::TypeId systemId)
 	{
-		system.postUpdateEvent(elapsed);
+		system.saveState(state.m_systems[systemId]);
 	});
 }
 
-void ecs::World::clear()
+void ecs::World::restoreState(WorldState const &state)
 {
-	removeAllSystems();
+	if (state.m_worldId != m_instanceId.getValue())
+	{
+		throw Exception{ "State has not been saved from this World.", "ecs::World::restoreState()" };
+	}
 
-	m_entities.clear();
-	m_actions.clear();
-	m_names.clear();
+	// The Component types are checked before anything is modified
+	for (detail::TypeId typeId{ 0 }; typeId < MAX_COMPONENTS; ++typeId)
+	{
+		auto const pool{ state.m_components.getPool(typeId) };
 
-	m_evtDispatcher.clearAll();
-	m_components.clear();
-	m_pool.reset();
+		if (pool != nullptr && !pool->getInfo().triviallyCopyable && pool->getInfo().copy == nullptr)
+		{
+			throw Exception{ "Component is not copyable.", "ecs::World::restoreState()" };
+		}
+	}
+
+	// Reserving first leaves the World untouched if the memory runs out
+	m_entities.reserve(state.m_entities.size());
+	m_actions.reserve(state.m_actions.size());
+	m_changes.reserve(state.m_changes.size());
+
+	try
+	{
+		m_entities = state.m_entities;
+		m_actions = state.m_actions;
+		m_changes = state.m_changes;
+		m_names = state.m_names;
+		m_components.copyFrom(state.m_components);
+		m_pool.restore(state.m_nextId, state.m_storedIds);
+
+		m_systems.forEach([&](System &system, detail::TypeId systemId)
+		{
+			auto const it{ state.m_systems.find(systemId) };
+
+			// Systems added since the save did not have any Entity
+			system.restoreState(it != state.m_systems.end() ? it->second : System::State{});
+		});
+
+		for (auto const &query : m_queries)
+		{
+			populateQuery(*query);
+		}
+	}
+	catch (...)
+	{
+		// Leave an empty World rather than a partially restored one, without
+		// triggering any System event
+		m_systems.forEach([](System &system, detail::TypeId)
+		{
+			system.restoreState(System::State{});
+		});
+
+		for (auto const &query : m_queries)
+		{
+			query->clear();
+		}
+
+		m_entities.clear();
+		m_actions.clear();
+		m_changes.clear();
+		m_names.clear();
+		m_components.clear();
+		m_pool.reset();
+
+		throw;
+	}
 }
 
 void ecs::World::updateEntities()
 {
 	// Here, we move m_actions to another vector to make possible to create, enable, etc.
 	// Entities within event handlers like system::onEntityAttached, etc.
-	auto const actionsList{ std::move(m_actions) };
-	m_actions = decltype(m_actions){};
+	// The memory of the previously processed actions is reused for the new ones
+	auto actionsList{ std::move(m_processedActions) };
+	actionsList.clear();
+	actionsList.swap(m_actions);
 
 	for (auto const &action : actionsList)
 	{
+		++m_frameStats.actionsProcessed;
+
 		try
 		{
 			executeAction(action);
 		}
 		catch (std::exception const &e)
 		{
-			Log::error(e.what());
+			m_errorReport->report("ecs::World::updateEntities()", e.what());
 		}
 	}
+
+	m_processedActions = std::move(actionsList);
 }
 
 void ecs::World::executeAction(EntityAction const &action)
@@ -215,6 +597,8 @@ void ecs::World::executeAction(EntityAction const &action)
 		throw InvalidEntity{ "ecs::World::executeAction()" };
 	}
 
+	markChanged(action.id);
+
 	switch (action.action)
 	{
 	case EntityAction::Action::Enable:
@@ -237,6 +621,13 @@ void ecs::World::executeAction(EntityAction const &action)
 
 void ecs::World::actionEnable(Entity::Id id)
 {
+	// Only the disabled Entities are counted, the created ones already are
+	if (m_entities[id].isDisabled)
+	{
+		m_entities[id].isDisabled = false;
+		++m_frameStats.entitiesEnabled;
+	}
+
 	m_systems.forEach([&](System &system, detail::TypeId systemId)
 	{
 		auto const status{ tryAttach(system, systemId, id) };
@@ -247,12 +638,20 @@ void ecs::World::actionEnable(Entity::Id id)
 			system.enableEntity(m_entities[id].entity);
 		}
 	});
+
+	refreshQueries(id, true);
 }
 
 void ecs::World::actionDisable(Entity::Id id)
 {
 	m_entities[id].isEnabled = false;
 
+	if (!m_entities[id].isDisabled)
+	{
+		m_entities[id].isDisabled = true;
+		++m_frameStats.entitiesDisabled;
+	}
+
 	m_systems.forEach([&](System &system, detail::TypeId systemId)
 	{
 		// Is the Entity attached to the System ?
@@ -261,6 +660,8 @@ void ecs::World::actionDisable(Entity::Id id)
 			system.disableEntity(m_entities[id].entity);
 		}
 	});
+
+	leaveQueries(id);
 }
 
 void ecs::World::actionRefresh(Entity::Id id)
@@ -276,6 +677,8 @@ void ecs::World::actionRefresh(Entity::Id id)
 			system.enableEntity(m_entities[id].entity);
 		}
 	});
+
+	refreshQueries(id, m_entities[id].isEnabled);
 }
 
 void ecs::World::actionRemove(Entity::Id id)
@@ -287,26 +690,219 @@ void ecs::World::actionRemove(Entity::Id id)
 		{
 			system.detachEntity(m_entities[id].entity);
 			m_entities[id].systems[systemId] = false;
+
+			++m_frameStats.detachCallbacks;
 		}
 	});
 
+	leaveQueries(id);
+
 	// Invalidate the Entity and reset its attributes
 	m_entities[id].isValid = false;
 	m_entities[id].systems.clear();
 
 	// Remove its name from the list
-	if (m_entities[id].name.has_value())
-	{
-		m_names.erase(m_entities[id].name.value());
-		m_entities[id].name.reset();
-	}
+	m_names.erase(id);
+
+	++m_frameStats.entitiesRemoved;
+	countRemovedComponents(id);
 
 	m_components.removeAllComponents(id);
 	m_pool.store(id);
 }
 
+void ecs::World::refreshQueries(Entity::Id id, bool enable)
+{
+	auto const mask{ m_components.getComponentsMask(id) };
+
+	for (auto const &query : m_queries)
+	{
+		if (!query->m_filter.check(mask))
+		{
+			query->erase(id);
+		}
+		else if (enable)
+		{
+			query->insert(m_entities[id].entity);
+		}
+	}
+}
+
+void ecs::World::leaveQueries(Entity::Id id)
+{
+	for (auto const &query : m_queries)
+	{
+		query->erase(id);
+	}
+}
+
+void ecs::World::populateQuery(Query &query)
+{
+	query.clear();
+
+	auto const matches{ [&](Entity::Id id)
+	{
+		auto const &attributes{ m_entities[id] };
+
+		if (attributes.isValid && attributes.isEnabled)
+		{
+			query.insert(attributes.entity);
+		}
+	} };
+
+	// Only the Entities having the required Components are visited
+	if (query.m_filter.getRequired().any())
+	{
+		m_components.forEachMatching(query.m_filter, matches);
+		return;
+	}
+
+	auto const &masks{ m_components.getComponentsMasks() };
+
+	for (Entity::Id id{ 0 }; id < std::min(masks.size(), m_entities.size()); ++id)
+	{
+		if (query.m_filter.check(masks[id]))
+		{
+			matches(id);
+		}
+	}
+}
+
+void ecs::World::attachExistingEntities(System &system, detail::TypeId systemId)
+{
+	auto const &filter{ system.getFilter() };
+	std::pmr::vector<Entity::Id> matches{ getMemoryResource() };
+
+	if (filter.getRequired().any())
+	{
+		// Only the Entities having the required Components are visited
+		m_frameStats.filterChecks += m_components.forEachMatching(filter, [&](Entity::Id id)
+		{
+			matches.push_back(id);
+		});
+	}
+	else
+	{
+		matchAllEntities(filter, matches);
+	}
+
+	// The lists of the System are allocated at once
+	std::size_t enabled{ 0 };
+	std::size_t disabled{ 0 };
+
+	for (auto const id : matches)
+	{
+		if (m_entities[id].isValid)
+		{
+			++(m_entities[id].isEnabled ? enabled : disabled);
+		}
+	}
+
+	system.reserve(enabled, disabled);
+
+	for (auto const id : matches)
+	{
+		auto &attributes{ m_entities[id] };
+
+		if (!attributes.isValid)
+		{
+			continue;
+		}
+
+		if (systemId >= attributes.systems.size())
+		{
+			attributes.systems.resize(systemId + 1, false);
+		}
+
+		attributes.systems[systemId] = true;
+		system.attachNewEntity(attributes.entity, attributes.isEnabled);
+
+		++m_frameStats.attachCallbacks;
+	}
+}
+
+void ecs::World::matchAllEntities(detail::ComponentFilter const &filter, std::pmr::vector<Entity::Id> &matches)
+{
+	// Below this number of Entities per thread, starting the threads costs more
+	constexpr std::size_t minEntitiesPerThread{ 16384 };
+
+	auto const &masks{ m_components.getComponentsMasks() };
+	auto const count{ std::min(masks.size(), m_entities.size()) };
+
+	if (count == 0)
+	{
+		return;
+	}
+
+	std::pmr::vector<std::uint8_t> flags(count, getMemoryResource());
+
+	auto threadCount{ m_attachThreadCount != 0 ? m_attachThreadCount : std::max<std::size_t>(std::thread::hardware_concurrency(), 1) };
+	threadCount = std::max<std::size_t>(std::min(threadCount, count / minEntitiesPerThread), 1);
+
+	auto const chunkSize{ (count + threadCount - 1) / threadCount };
+
+	auto const checkChunk{ [&](std::size_t chunk)
+	{
+		auto const begin{ chunk * chunkSize };
+		auto const end{ std::min(begin + chunkSize, count) };
+
+		filter.checkAll(masks.data() + begin, end - begin, flags.data() + begin);
+	} };
+
+	std::vector<std::thread> workers;
+
+	auto const joinWorkers{ [&]
+	{
+		for (auto &worker : workers)
+		{
+			worker.join();
+		}
+	} };
+
+	try
+	{
+		workers.reserve(threadCount - 1);
+
+		for (std::size_t chunk{ 1 }; chunk < threadCount; ++chunk)
+		{
+			try
+			{
+				workers.emplace_back(checkChunk, chunk);
+			}
+			catch (std::system_error const &)
+			{
+				// No thread available, the chunk is checked here
+				checkChunk(chunk);
+			}
+		}
+
+		checkChunk(0);
+	}
+	catch (...)
+	{
+		// The started threads use the flags, they must end before the
+		// exception leaves this function
+		joinWorkers();
+		throw;
+	}
+
+	joinWorkers();
+
+	m_frameStats.filterChecks += count;
+
+	for (Entity::Id id{ 0 }; id < count; ++id)
+	{
+		if (flags[id])
+		{
+			matches.push_back(id);
+		}
+	}
+}
+
 ecs::World::AttachStatus ecs::World::tryAttach(System &system, detail::TypeId systemId, Entity::Id id)
 {
+	++m_frameStats.filterChecks;
+
 	// Does the Entity match the requirements to be part of the System ?
 	if (system.getFilter().check(m_components.getComponentsMask(id)))
 	{
@@ -321,6 +917,8 @@ ecs::World::AttachStatus ecs::World::tryAttach(System &system, detail::TypeId sy
 			m_entities[id].systems[systemId] = true;
 			system.attachEntity(m_entities[id].entity);
 
+			++m_frameStats.attachCallbacks;
+
 			// The Entity has been attached to the System
 			return AttachStatus::Attached;
 		}
@@ -335,6 +933,8 @@ ecs::World::AttachStatus ecs::World::tryAttach(System &system, detail::TypeId sy
 		system.detachEntity(m_entities[id].entity);
 		m_entities[id].systems[systemId] = false;
 
+		++m_frameStats.detachCallbacks;
+
 		// The Entity has been detached from the System
 		return AttachStatus::Detached;
 	}
@@ -352,3 +952,27 @@ void ecs::World::extend(std::size_t size)
 		m_components.resize(size);
 	}
 }
+
+void ecs::World::resetEntities()
+{
+	m_systems.forEach([](System &system, detail::TypeId)
+	{
+		system.detachAll();
+	});
+
+	for (auto const &query : m_queries)
+	{
+		query->clear();
+	}
+
+	m_entities.clear();
+	m_actions.clear();
+	m_names.clear();
+
+	// The IDs will be reused by other Entities
+	m_changes.clear();
+	m_resetVersion = m_version;
+
+	m_components.clear();
+	m_pool.reset();
+}
@@ -0,0 +1,14 @@
+// Copyright (c) 2021 Ethan Margaillan <contact@ethan.jp>.
+// Licensed under the MIT License - https://raw.githubusercontent.com/Ethan13310/ECS/master/LICENSE
+
+#include <ECS/WorldState.hpp>
+
+bool ecs::WorldState::isEmpty() const noexcept
+{
+	return m_worldId == 0;
+}
+
+void ecs::WorldState::clear()
+{
+	*this = WorldState{};
+}
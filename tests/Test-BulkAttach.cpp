@@ -0,0 +1,171 @@
+// Copyright (c) 2021 Ethan Margaillan <contact@ethan.jp>.
+// Licensed under the MIT License - https://raw.githubusercontent.com/Ethan13310/ECS/master/LICENSE
+
+#include <vector>
+
+#include <ECS.hpp>
+#include <lest/lest.hpp>
+
+struct Position : public ecs::Component {};
+struct Velocity : public ecs::Component {};
+struct Frozen : public ecs::Component {};
+
+class MovementSystem : public ecs::System
+{
+public:
+	MovementSystem()
+	{
+		getFilter().require<Position>();
+		getFilter().require<Velocity>();
+		getFilter().exclude<Frozen>();
+	}
+
+	void onStart() override
+	{
+		started = attached == 0;
+	}
+
+	void onEntityAttached(ecs::Entity) override
+	{
+		++attached;
+	}
+
+	void onEntityEnabled(ecs::Entity) override
+	{
+		++enabled;
+	}
+
+	bool started{ false };
+	int attached{ 0 };
+	int enabled{ 0 };
+};
+
+// Without required Components, all the masks are checked
+class StillSystem : public ecs::System
+{
+public:
+	StillSystem()
+	{
+		getFilter().exclude<Velocity>();
+	}
+};
+
+// Create count Entities, one out of three moving, one out of five moving ones frozen
+std::vector<ecs::Entity> populate(ecs::World &world, int count)
+{
+	std::vector<ecs::Entity> entities;
+
+	for (int i{ 0 }; i < count; ++i)
+	{
+		auto entity{ world.createEntity() };
+		entity.addComponent<Position>();
+
+		if (i % 3 == 0)
+		{
+			entity.addComponent<Velocity>();
+
+			if (i % 5 == 0)
+			{
+				entity.addComponent<Frozen>();
+			}
+		}
+
+		entities.push_back(entity);
+	}
+
+	world.update(0.f);
+
+	return entities;
+}
+
+lest::test const specification[] =
+{
+	CASE("The existing Entities are attached to a new System")
+	{
+		ecs::World world;
+
+		auto entities{ populate(world, 30) };
+
+		entities[3].disable();
+		entities[6].remove();
+		world.update(0.f);
+
+		auto &system{ world.addSystem<MovementSystem>() };
+		world.update(0.f);
+
+		// 0, 15 are frozen, 6 is removed, 3 is disabled
+		EXPECT(system.started);
+		EXPECT(system.attached == 7);
+		EXPECT(system.enabled == 6);
+		EXPECT(system.getEntityCount() == 6u);
+
+		// The next changes go through the usual path
+		entities[9].addComponent<Frozen>();
+		world.update(0.f);
+
+		EXPECT(system.getEntityCount() == 5u);
+	},
+
+	CASE("The Entities are matched in parallel in large Worlds")
+	{
+		ecs::World serial;
+		ecs::World parallel;
+
+		parallel.setAttachThreadCount(4);
+
+		populate(serial, 100000);
+		populate(parallel, 100000);
+
+		auto &serialSystem{ serial.addSystem<StillSystem>() };
+		auto &parallelSystem{ parallel.addSystem<StillSystem>() };
+
+		serial.update(0.f);
+		parallel.update(0.f);
+
+		EXPECT(parallelSystem.getEntityCount() == serialSystem.getEntityCount());
+
+		bool identical{ true };
+
+		for (std::size_t i{ 0 }; i < serialSystem.getEntityCount(); ++i)
+		{
+			identical = identical && parallelSystem.getEntities()[i].getId() == serialSystem.getEntities()[i].getId();
+		}
+
+		EXPECT(identical);
+		EXPECT(parallel.getFrameStats().attachCallbacks == serialSystem.getEntityCount());
+		EXPECT(parallel.getFrameStats().filterChecks == 100000u);
+	},
+
+	CASE("Only the Entities having the required Components are visited")
+	{
+		ecs::World world;
+
+		for (int i{ 0 }; i < 100000; ++i)
+		{
+			world.createEntity().addComponent<Position>();
+		}
+
+		// Only the last 100 Entities move
+		for (int i{ 0 }; i < 100; ++i)
+		{
+			auto entity{ world.createEntity() };
+			entity.addComponent<Position>();
+			entity.addComponent<Velocity>();
+		}
+
+		world.update(0.f);
+
+		auto &system{ world.addSystem<MovementSystem>() };
+		world.update(0.f);
+
+		// Only the 64-Entity words holding the moving Entities are examined
+		EXPECT(system.getEntityCount() == 100u);
+		EXPECT(world.getFrameStats().filterChecks >= 100u);
+		EXPECT(world.getFrameStats().filterChecks <= 100u + 2u * 64u);
+	}
+};
+
+int main(int argc, char **argv)
+{
+	return lest::run(specification, argc, argv);
+}
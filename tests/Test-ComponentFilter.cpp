@@ -124,6 +124,69 @@ lest::test const specification[] =
 		EXPECT_NOT(filter.check(0b011000));
 		EXPECT_NOT(filter.check(0b011100));
 		EXPECT_NOT(filter.check(0b111111));
+	},
+
+	CASE("Require any of")
+	{
+		ecs::detail::ComponentFilter filter;
+
+		filter.require<A>();
+		filter.requireAnyOf<D, E>();
+		filter.exclude<F>();
+
+		EXPECT(filter.check(0b001001));
+		EXPECT(filter.check(0b010001));
+		EXPECT(filter.check(0b011001));
+		EXPECT(filter.check(0b011011));
+
+		EXPECT_NOT(filter.check(0b000001));
+		EXPECT_NOT(filter.check(0b011000));
+		EXPECT_NOT(filter.check(0b101001));
+		EXPECT_NOT(filter.check(0b000000));
+
+		filter.excludeNotRequired();
+
+		EXPECT(filter.check(0b011001));
+		EXPECT_NOT(filter.check(0b011011));
+	},
+
+	CASE("Several any-of groups")
+	{
+		ecs::detail::ComponentFilter filter;
+
+		filter.requireAnyOf<A, B>();
+		filter.requireAnyOf<C, D>();
+
+		EXPECT(filter.check(0b000101));
+		EXPECT(filter.check(0b001010));
+		EXPECT(filter.check(0b001111));
+
+		EXPECT_NOT(filter.check(0b000011));
+		EXPECT_NOT(filter.check(0b001100));
+		EXPECT_NOT(filter.check(0b110000));
+
+		// The group of C and D is dropped once empty
+		filter.ignore<C>();
+		filter.ignore<D>();
+
+		EXPECT(filter.getAnyOf().size() == 1u);
+		EXPECT(filter.check(0b000001));
+		EXPECT_NOT(filter.check(0b001100));
+	},
+
+	CASE("Optional components are not excluded")
+	{
+		ecs::detail::ComponentFilter filter;
+
+		filter.require<A>();
+		filter.optional<B>();
+		filter.excludeNotRequired();
+
+		EXPECT(filter.check(0b000001));
+		EXPECT(filter.check(0b000011));
+
+		EXPECT_NOT(filter.check(0b000010));
+		EXPECT_NOT(filter.check(0b000101));
 	}
 };
 
@@ -1,6 +1,7 @@
 // Copyright (c) 2021 Ethan Margaillan <contact@ethan.jp>.
 // Licensed under the MIT License - https://raw.githubusercontent.com/Ethan13310/ECS/master/LICENSE
 
+#include <cstdint>
 #include <memory>
 
 #include <ECS.hpp>
@@ -15,6 +16,16 @@ struct B : public ecs::Component {};
 struct C : public ecs::Component {};
 struct D : public ecs::Component {};
 
+struct alignas(32) Vector : public ecs::Component
+{
+	float values[8]{};
+};
+
+struct alignas(128) Wide : public ecs::Component
+{
+	char value{ 0 };
+};
+
 template <class T>
 void const* addressOf(T const& instance)
 {
@@ -129,6 +140,46 @@ lest::test const specification[] =
 		EXPECT_NOT(addressOf(holder.getComponent<D>(0)) == addressOf(holder.getComponent<D>(1)));
 		EXPECT_NOT(addressOf(holder.getComponent<A>(0)) == addressOf(holder.getComponent<D>(0)));
 		EXPECT_NOT(addressOf(holder.getComponent<D>(0)) == addressOf(holder.getComponent<A>(0)));
+	},
+
+	CASE("Over-aligned components")
+	{
+		auto const isAligned = [](void const *address, std::size_t alignment)
+		{
+			return reinterpret_cast<std::uintptr_t>(address) % alignment == 0;
+		};
+
+		ecs::detail::ComponentHolder holder;
+		holder.resize(2000);
+
+		for (ecs::Entity::Id id{ 0 }; id < 2000; ++id)
+		{
+			holder.addComponent(id, std::make_unique<Vector>());
+			holder.emplaceComponent<Wide>(id);
+		}
+
+		for (ecs::Entity::Id id{ 0 }; id < 2000; ++id)
+		{
+			EXPECT(isAligned(addressOf(holder.getComponent<Vector>(id)), alignof(Vector)));
+			EXPECT(isAligned(addressOf(holder.getComponent<Wide>(id)), alignof(Wide)));
+		}
+
+		// Each page starts on a cache line, whatever the Component alignment
+		auto const pool{ holder.getPool(ecs::getComponentTypeId<A>()) };
+
+		holder.addComponent(0, std::make_unique<A>());
+
+		EXPECT(pool == nullptr);
+		EXPECT(holder.getPool(ecs::getComponentTypeId<A>())->getPageAlignment() == ecs::detail::ComponentPool::PAGE_ALIGNMENT);
+		EXPECT(isAligned(addressOf(holder.getComponent<A>(0)), ecs::detail::ComponentPool::PAGE_ALIGNMENT));
+		EXPECT(holder.getPool(ecs::getComponentTypeId<Wide>())->getPageAlignment() == std::max<std::size_t>(128, ecs::detail::ComponentPool::PAGE_ALIGNMENT));
+
+		// Copies keep the alignment
+		ecs::detail::ComponentHolder copy;
+		copy.copyFrom(holder);
+
+		EXPECT(isAligned(addressOf(copy.getComponent<Vector>(1999)), alignof(Vector)));
+		EXPECT(isAligned(addressOf(copy.getComponent<Wide>(1999)), alignof(Wide)));
 	}
 };
 
@@ -0,0 +1,161 @@
+// Copyright (c) 2021 Ethan Margaillan <contact@ethan.jp>.
+// Licensed under the MIT License - https://raw.githubusercontent.com/Ethan13310/ECS/master/LICENSE
+
+#include <cstdint>
+#include <vector>
+
+#include <ECS.hpp>
+#include <lest/lest.hpp>
+
+struct A : public ecs::Component {};
+struct B : public ecs::Component {};
+struct C : public ecs::Component {};
+struct D : public ecs::Component {};
+
+using ecs::detail::EntityBitset;
+
+lest::test const specification[] =
+{
+	CASE("Entities are added and removed")
+	{
+		EntityBitset set;
+
+		EXPECT(set.none());
+
+		set.set(3);
+		set.set(70);
+		set.set(5000);
+
+		EXPECT(set.test(3));
+		EXPECT(set.test(70));
+		EXPECT(set.test(5000));
+		EXPECT_NOT(set.test(4));
+		EXPECT_NOT(set.test(100000));
+
+		EXPECT(set.getWord(0) == std::uint64_t{ 1 } << 3);
+		EXPECT(set.getSummary(0) == 0b11u);
+		EXPECT(set.getSummary(1) == std::uint64_t{ 1 } << (5000 / 64 - 64));
+		EXPECT(set.getSummaryCount() == 2u);
+
+		set.reset(70);
+
+		EXPECT_NOT(set.test(70));
+		EXPECT(set.getSummary(0) == 0b01u);
+
+		set.reset(3);
+		set.reset(5000);
+
+		EXPECT(set.none());
+	},
+
+	CASE("shrinkToFit() forgets the Entities past the size")
+	{
+		EntityBitset set;
+
+		set.set(10);
+		set.set(100);
+		set.set(9000);
+
+		set.shrinkToFit(101);
+
+		EXPECT(set.test(10));
+		EXPECT(set.test(100));
+		EXPECT_NOT(set.test(9000));
+		EXPECT(set.getSummaryCount() == 1u);
+
+		set.shrinkToFit(100);
+
+		EXPECT_NOT(set.test(100));
+		EXPECT(set.getSummary(0) == 0b1u);
+	},
+
+	CASE("The Component holder keeps a set per Component type")
+	{
+		ecs::detail::ComponentHolder holder;
+
+		holder.resize(10);
+		holder.emplaceComponent<A>(2);
+		holder.emplaceComponent<A>(7);
+		holder.emplaceComponent<B>(7);
+
+		auto const &set{ holder.getEntities(ecs::getComponentTypeId<A>()) };
+
+		EXPECT(set.test(2));
+		EXPECT(set.test(7));
+
+		holder.removeComponent<A>(2);
+		EXPECT_NOT(set.test(2));
+
+		holder.removeAllComponents(7);
+		EXPECT(set.none());
+		EXPECT(holder.getEntities(ecs::getComponentTypeId<B>()).none());
+
+		ecs::detail::ComponentFilter::Mask mask;
+		mask.set(ecs::getComponentTypeId<A>());
+
+		holder.setComponentsMask(4, mask);
+		EXPECT(set.test(4));
+	},
+
+	CASE("forEachMatching() matches the same Entities as the filter")
+	{
+		ecs::detail::ComponentHolder holder;
+
+		constexpr std::size_t count{ 20000 };
+		holder.resize(count);
+
+		for (std::size_t id{ 0 }; id < count; ++id)
+		{
+			// Sparse A, with an empty region in the middle
+			if (id % 7 == 0 && (id < 5000 || id > 12000))
+			{
+				holder.emplaceComponent<A>(id);
+			}
+
+			if (id % 2 == 0)
+			{
+				holder.emplaceComponent<B>(id);
+			}
+
+			if (id % 3 == 0)
+			{
+				holder.emplaceComponent<C>(id);
+			}
+
+			if (id % 5 == 0)
+			{
+				holder.emplaceComponent<D>(id);
+			}
+		}
+
+		ecs::detail::ComponentFilter filter;
+
+		filter.require<A>();
+		filter.exclude<B>();
+		filter.requireAnyOf<C, D>();
+
+		std::vector<ecs::Entity::Id> expected;
+
+		for (std::size_t id{ 0 }; id < count; ++id)
+		{
+			if (filter.check(holder.getComponentsMask(id)))
+			{
+				expected.push_back(id);
+			}
+		}
+
+		std::vector<ecs::Entity::Id> matches;
+
+		holder.forEachMatching(filter, [&](ecs::Entity::Id id) {
+			matches.push_back(id);
+		});
+
+		EXPECT(!expected.empty());
+		EXPECT(matches == expected);
+	}
+};
+
+int main(int argc, char **argv)
+{
+	return lest::run(specification, argc, argv);
+}
@@ -0,0 +1,140 @@
+// Copyright (c) 2021 Ethan Margaillan <contact@ethan.jp>.
+// Licensed under the MIT License - https://raw.githubusercontent.com/Ethan13310/ECS/master/LICENSE
+
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+
+#include <ECS.hpp>
+#include <lest/lest.hpp>
+
+class FailingSystem : public ecs::System
+{
+public:
+	void onUpdate(float) override
+	{
+		throw std::runtime_error{ "Update failed." };
+	}
+};
+
+lest::test const specification[] =
+{
+	CASE("Count identical errors")
+	{
+		ecs::ErrorReport report;
+
+		report.report("Site", "First error.");
+		report.report("Site", "First error.");
+		report.report("Other site", "First error.");
+		report.report("Site", "Second error.");
+
+		EXPECT(report.getCount("Site", "First error.") == 2);
+		EXPECT(report.getCount("Other site", "First error.") == 1);
+		EXPECT(report.getCount("Site", "Second error.") == 1);
+		EXPECT(report.getCount("Site", "Unknown error.") == 0);
+
+		auto const counters{ report.getCounters() };
+
+		EXPECT(counters.size() == 3);
+		EXPECT(counters[0].site == "Site");
+		EXPECT(counters[0].message == "First error.");
+		EXPECT(counters[0].count == 2);
+
+		report.reset();
+
+		EXPECT(report.getCounters().empty());
+	},
+
+	CASE("Count the errors of the Systems")
+	{
+		ecs::World world;
+		world.getErrorReport().setWindow(10);
+		world.addSystem<FailingSystem>();
+
+		for (int i{ 0 }; i < 25; ++i)
+		{
+			world.update(0);
+		}
+
+		auto const counters{ world.getErrorReport().getCounters() };
+
+		EXPECT(counters.size() == 1);
+		EXPECT(counters[0].message == "Update failed.");
+		EXPECT(counters[0].count == 25);
+	},
+
+	CASE("Each World has its own report")
+	{
+		ecs::World failing;
+		failing.addSystem<FailingSystem>();
+
+		ecs::World working;
+
+		failing.update(0);
+		working.update(0);
+
+		EXPECT(failing.getErrorReport().getCount("ecs::System::callEvent()", "Update failed.") == 1);
+		EXPECT(working.getErrorReport().getCounters().empty());
+	},
+
+	CASE("The least recently reported errors are forgotten")
+	{
+		ecs::ErrorReport report;
+		report.setCapacity(3);
+
+		report.report("Site", "0");
+		report.endFrame();
+		report.report("Site", "1");
+		report.endFrame();
+		report.report("Site", "2");
+		report.endFrame();
+
+		// Reporting an error again keeps it
+		report.report("Site", "0");
+		report.endFrame();
+		report.report("Site", "3");
+
+		EXPECT(report.getCounters().size() == 3);
+		EXPECT(report.getCount("Site", "0") == 2);
+		EXPECT(report.getCount("Site", "1") == 0);
+		EXPECT(report.getCount("Site", "2") == 1);
+		EXPECT(report.getCount("Site", "3") == 1);
+
+		for (int i{ 4 }; i < 100; ++i)
+		{
+			report.report("Site", std::to_string(i));
+		}
+
+		EXPECT(report.getCounters().size() == 3);
+		EXPECT(report.getCount("Site", "99") == 1);
+
+		report.setCapacity(1);
+
+		EXPECT(report.getCounters().size() == 1);
+	},
+
+	CASE("The repeated occurrences of a forgotten error are logged")
+	{
+		ecs::ErrorReport report;
+		report.setCapacity(1);
+
+		std::ostringstream output;
+		auto const previous{ std::cout.rdbuf(output.rdbuf()) };
+
+		report.report("Site", "Forgotten error.");
+		report.report("Site", "Forgotten error.");
+		report.report("Site", "Forgotten error.");
+		report.report("Site", "New error.");
+
+		std::cout.rdbuf(previous);
+
+		EXPECT(output.str().find("Forgotten error. (repeated 2 times in Site)") != std::string::npos);
+		EXPECT(output.str().find("New error.") != std::string::npos);
+	}
+};
+
+int main(int argc, char **argv)
+{
+	return lest::run(specification, argc, argv);
+}
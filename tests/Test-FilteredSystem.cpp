@@ -0,0 +1,168 @@
+// Copyright (c) 2021 Ethan Margaillan <contact@ethan.jp>.
+// Licensed under the MIT License - https://raw.githubusercontent.com/Ethan13310/ECS/master/LICENSE
+
+#include <tuple>
+#include <type_traits>
+
+#include <ECS.hpp>
+#include <lest/lest.hpp>
+
+struct Position : public ecs::Component
+{
+	Position(float x = 0.f) : x{ x } {}
+
+	float x;
+};
+
+struct Velocity : public ecs::Component
+{
+	Velocity(float x = 0.f) : x{ x } {}
+
+	float x;
+};
+
+struct Frozen : public ecs::Component {};
+struct Mesh : public ecs::Component {};
+struct Sprite : public ecs::Component {};
+
+class MovementSystem : public ecs::FilteredSystem<ecs::Require<Position, Velocity>, ecs::Exclude<Frozen>>
+{
+public:
+	void onUpdate(float elapsed) override
+	{
+		forEach([elapsed](ecs::Entity &, Position &position, Velocity &velocity) {
+			position.x += velocity.x * elapsed;
+		});
+	}
+};
+
+class RenderSystem : public ecs::FilteredSystem<ecs::Require<Position>, ecs::AnyOf<Mesh, Sprite>, ecs::Optional<Velocity>>
+{
+public:
+	void onUpdate(float) override
+	{
+		meshes = 0;
+		sprites = 0;
+		moving = 0;
+
+		forEach([this](ecs::Entity &, Position &, Mesh *mesh, Sprite *sprite, Velocity *velocity) {
+			meshes += mesh != nullptr;
+			sprites += sprite != nullptr;
+			moving += velocity != nullptr;
+		});
+	}
+
+	int meshes{ 0 };
+	int sprites{ 0 };
+	int moving{ 0 };
+};
+
+static_assert(std::is_same<MovementSystem::RequiredComponents, std::tuple<Position, Velocity>>::value);
+static_assert(std::is_same<RenderSystem::RequiredComponents, std::tuple<Position>>::value);
+static_assert(std::is_same<RenderSystem::MaybeComponents, std::tuple<Mesh, Sprite, Velocity>>::value);
+
+lest::test const specification[] =
+{
+	CASE("The filter is available without instantiating the System")
+	{
+		auto const &filter{ MovementSystem::getStaticFilter() };
+
+		EXPECT(filter.getRequired().test(ecs::getComponentTypeId<Position>()));
+		EXPECT(filter.getRequired().test(ecs::getComponentTypeId<Velocity>()));
+		EXPECT(filter.getExcluded().test(ecs::getComponentTypeId<Frozen>()));
+		EXPECT(filter.getAnyOf().empty());
+
+		auto const &render{ RenderSystem::getStaticFilter() };
+
+		EXPECT(render.getAnyOf().size() == 1u);
+		EXPECT(render.getAnyOf().front().test(ecs::getComponentTypeId<Mesh>()));
+		EXPECT(render.getAnyOf().front().test(ecs::getComponentTypeId<Sprite>()));
+		EXPECT(render.getOptional().test(ecs::getComponentTypeId<Velocity>()));
+	},
+
+	CASE("Entities are attached according to the Terms")
+	{
+		ecs::World world;
+
+		auto &movement{ world.addSystem<MovementSystem>() };
+		auto &render{ world.addSystem<RenderSystem>() };
+
+		auto moving{ world.createEntity() };
+		moving.addComponent<Position>();
+		moving.addComponent<Velocity>();
+		moving.addComponent<Sprite>();
+
+		auto frozen{ world.createEntity() };
+		frozen.addComponent<Position>();
+		frozen.addComponent<Velocity>();
+		frozen.addComponent<Frozen>();
+
+		auto invisible{ world.createEntity() };
+		invisible.addComponent<Position>();
+
+		world.update(0.f);
+
+		EXPECT(movement.getEntityCount() == 1u);
+		EXPECT(movement.getEntities().front() == moving);
+		EXPECT(render.getEntityCount() == 1u);
+		EXPECT(render.getEntities().front() == moving);
+	},
+
+	CASE("forEach provides the required Components")
+	{
+		ecs::World world;
+
+		world.addSystem<MovementSystem>();
+
+		auto entity{ world.createEntity() };
+		entity.addComponent<Position>(1.f);
+		entity.addComponent<Velocity>(2.f);
+
+		world.update(0.f);
+		world.update(0.5f);
+
+		EXPECT(entity.getComponent<Position>().x == 2.f);
+
+		int count{ 0 };
+
+		world.getSystem<MovementSystem>().forEach([&count](ecs::Entity const &) {
+			++count;
+		});
+
+		EXPECT(count == 1);
+	},
+
+	CASE("forEach provides the any-of and optional Components if present")
+	{
+		ecs::World world;
+
+		auto &render{ world.addSystem<RenderSystem>() };
+
+		auto mesh{ world.createEntity() };
+		mesh.addComponent<Position>();
+		mesh.addComponent<Mesh>();
+		mesh.addComponent<Velocity>();
+
+		auto sprite{ world.createEntity() };
+		sprite.addComponent<Position>();
+		sprite.addComponent<Sprite>();
+
+		auto both{ world.createEntity() };
+		both.addComponent<Position>();
+		both.addComponent<Mesh>();
+		both.addComponent<Sprite>();
+
+		world.update(0.f);
+		world.update(0.f);
+
+		EXPECT(render.getEntityCount() == 3u);
+		EXPECT(render.meshes == 2);
+		EXPECT(render.sprites == 2);
+		EXPECT(render.moving == 1);
+	}
+};
+
+int main(int argc, char **argv)
+{
+	return lest::run(specification, argc, argv);
+}
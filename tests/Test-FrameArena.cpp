@@ -0,0 +1,116 @@
+// Copyright (c) 2021 Ethan Margaillan <contact@ethan.jp>.
+// Licensed under the MIT License - https://raw.githubusercontent.com/Ethan13310/ECS/master/LICENSE
+
+#include <cstdint>
+#include <memory_resource>
+#include <vector>
+
+#include <ECS.hpp>
+#include <lest/lest.hpp>
+
+struct Position : public ecs::Component
+{
+	float x{ 0.f };
+};
+
+class SortSystem : public ecs::System
+{
+public:
+	SortSystem()
+	{
+		getFilter().require<Position>();
+	}
+
+	void onUpdate(float) override
+	{
+		std::pmr::vector<float> values{ &getWorld().getFrameResource() };
+
+		forEach([&](ecs::Entity const &entity)
+		{
+			values.push_back(entity.getComponent<Position>().x);
+		});
+
+		count = values.size();
+	}
+
+	std::size_t count{ 0 };
+};
+
+lest::test const specification[] =
+{
+	CASE("Allocations are aligned")
+	{
+		ecs::detail::FrameArena arena;
+
+		auto const first{ arena.allocate(3, 1) };
+		auto const second{ arena.allocate(16, 64) };
+
+		EXPECT(first != nullptr);
+		EXPECT(reinterpret_cast<std::uintptr_t>(second) % 64 == 0u);
+		EXPECT(arena.getMemoryUsage().used == 19u);
+	},
+
+	CASE("Reset releases the memory")
+	{
+		ecs::detail::FrameArena arena;
+
+		auto const first{ arena.allocate(100, 8) };
+
+		arena.reset();
+
+		EXPECT(arena.getMemoryUsage().used == 0u);
+		EXPECT(arena.allocate(100, 8) == first);
+	},
+
+	CASE("Blocks are merged on reset")
+	{
+		ecs::detail::FrameArena arena;
+
+		for (int i{ 0 }; i < 4; ++i)
+		{
+			EXPECT(arena.allocate(ecs::detail::FrameArena::BLOCK_SIZE / 2, 8) != nullptr);
+		}
+
+		auto const reserved{ arena.getMemoryUsage().reserved };
+
+		arena.reset();
+
+		EXPECT(arena.getMemoryUsage().reserved == reserved);
+
+		// The whole frame fits into the merged block
+		auto const first{ arena.allocate(ecs::detail::FrameArena::BLOCK_SIZE / 2, 8) };
+
+		for (int i{ 0 }; i < 3; ++i)
+		{
+			EXPECT(arena.allocate(ecs::detail::FrameArena::BLOCK_SIZE / 2, 8) != nullptr);
+		}
+
+		arena.reset();
+
+		EXPECT(arena.allocate(8, 8) == first);
+		EXPECT(arena.getMemoryUsage().reserved == reserved);
+	},
+
+	CASE("The World resets the arena after each update")
+	{
+		ecs::World world;
+
+		auto &system{ world.addSystem<SortSystem>() };
+
+		for (int i{ 0 }; i < 1000; ++i)
+		{
+			world.createEntity().addComponent<Position>();
+		}
+
+		world.update(0.f);
+
+		EXPECT(system.count == 1000u);
+		EXPECT(world.memoryStats().frameArena.used == 0u);
+		EXPECT(world.memoryStats().frameArena.reserved > 0u);
+	}
+};
+
+int main(int argc, char **argv)
+{
+	return lest::run(specification, argc, argv);
+}
@@ -0,0 +1,161 @@
+// Copyright (c) 2021 Ethan Margaillan <contact@ethan.jp>.
+// Licensed under the MIT License - https://raw.githubusercontent.com/Ethan13310/ECS/master/LICENSE
+
+#include <ECS.hpp>
+#include <lest/lest.hpp>
+
+struct Position : public ecs::Component
+{
+	float x{ 0.f };
+	float y{ 0.f };
+};
+
+struct Velocity : public ecs::Component
+{
+	float x{ 0.f };
+	float y{ 0.f };
+};
+
+struct Collision : public ecs::Event
+{
+};
+
+class MovementSystem : public ecs::System
+{
+public:
+	MovementSystem()
+	{
+		getFilter().require<Position>();
+		getFilter().require<Velocity>();
+	}
+
+	void onUpdate(float) override
+	{
+		for (std::size_t i{ 0 }; i < getEntities().size(); ++i)
+		{
+			emitEvent(Collision{});
+		}
+	}
+};
+
+lest::test const specification[] =
+{
+	CASE("No frame has been updated")
+	{
+		ecs::World world;
+
+		auto const &stats{ world.getFrameStats() };
+
+		EXPECT(stats.entitiesCreated == 0u);
+		EXPECT(stats.actionsProcessed == 0u);
+		EXPECT(stats.getComponentsAdded<Position>() == 0u);
+		EXPECT(stats.getEventsEmitted<Collision>() == 0u);
+	},
+
+	CASE("Structural changes are counted per frame")
+	{
+		ecs::World world;
+
+		world.addSystem<MovementSystem>();
+
+		auto first{ world.createEntity() };
+		auto second{ world.createEntity() };
+
+		first.addComponent<Position>();
+		first.addComponent<Velocity>();
+		second.addComponent<Position>();
+
+		world.update(0.f);
+
+		auto const &stats{ world.getFrameStats() };
+
+		EXPECT(stats.entitiesCreated == 2u);
+		EXPECT(stats.entitiesEnabled == 2u);
+		EXPECT(stats.getComponentsAdded<Position>() == 2u);
+		EXPECT(stats.getComponentsAdded<Velocity>() == 1u);
+
+		// 2 enable and 3 refresh actions, each checked against the System,
+		// after the 2 existing Entities have been matched when the System started
+		EXPECT(stats.actionsProcessed == 5u);
+		EXPECT(stats.filterChecks == 7u);
+		EXPECT(stats.attachCallbacks == 1u);
+		EXPECT(stats.detachCallbacks == 0u);
+		EXPECT(stats.getEventsEmitted<Collision>() == 1u);
+
+		// The next frame starts from zero
+		first.removeComponent<Velocity>();
+		second.remove();
+
+		world.update(0.f);
+
+		EXPECT(stats.entitiesCreated == 0u);
+		EXPECT(stats.entitiesRemoved == 1u);
+		EXPECT(stats.getComponentsAdded<Position>() == 0u);
+		EXPECT(stats.getComponentsRemoved<Velocity>() == 1u);
+		EXPECT(stats.getComponentsRemoved<Position>() == 1u);
+		EXPECT(stats.actionsProcessed == 2u);
+		EXPECT(stats.detachCallbacks == 1u);
+		EXPECT(stats.getEventsEmitted<Collision>() == 0u);
+	},
+
+	CASE("Disabled Entities")
+	{
+		ecs::World world;
+
+		world.addSystem<MovementSystem>();
+
+		auto entity{ world.createEntity() };
+
+		world.update(0.f);
+
+		entity.disable();
+		entity.enable();
+
+		world.update(0.f);
+
+		EXPECT(world.getFrameStats().entitiesDisabled == 1u);
+		EXPECT(world.getFrameStats().entitiesEnabled == 1u);
+	},
+
+	CASE("Operations without effect are not counted")
+	{
+		ecs::World world;
+
+		auto entity{ world.createEntity() };
+		entity.addComponent<Position>();
+
+		world.update(0.f);
+
+		entity.enable();
+		entity.removeComponent<Velocity>();
+
+		world.update(0.f);
+
+		EXPECT(world.getFrameStats().entitiesEnabled == 0u);
+		EXPECT(world.getFrameStats().getComponentsRemoved<Velocity>() == 0u);
+
+		entity.disable();
+		entity.disable();
+
+		world.update(0.f);
+
+		EXPECT(world.getFrameStats().entitiesDisabled == 1u);
+		EXPECT_NOT(entity.isEnabled());
+
+		// The second removal fails when the actions are processed
+		entity.addComponent<Position>();
+		entity.remove();
+		entity.remove();
+
+		world.update(0.f);
+
+		EXPECT(world.getFrameStats().getComponentsAdded<Position>() == 0u);
+		EXPECT(world.getFrameStats().entitiesRemoved == 1u);
+		EXPECT(world.getFrameStats().getComponentsRemoved<Position>() == 1u);
+	}
+};
+
+int main(int argc, char **argv)
+{
+	return lest::run(specification, argc, argv);
+}
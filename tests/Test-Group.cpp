@@ -0,0 +1,289 @@
+// Copyright (c) 2021 Ethan Margaillan <contact@ethan.jp>.
+// Licensed under the MIT License - https://raw.githubusercontent.com/Ethan13310/ECS/master/LICENSE
+
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <ECS.hpp>
+#include <lest/lest.hpp>
+
+struct Position : public ecs::Component
+{
+	Position(float x = 0.f) : x{ x } {}
+
+	float x;
+};
+
+struct Velocity : public ecs::Component
+{
+	Velocity(float dx = 0.f) : dx{ dx } {}
+
+	float dx;
+};
+
+struct Label : public ecs::Component
+{
+	Label(std::string text = {}) : text{ std::move(text) } {}
+
+	std::string text;
+};
+
+struct Large : public ecs::Component
+{
+	Large(int value = 0) : value{ value } {}
+
+	int value;
+	char padding[1020];
+};
+
+// Check that each Entity of the group has its own Components
+bool checkGroup(ecs::Group<Position, Velocity> &group, std::size_t expected)
+{
+	std::size_t count{ 0 };
+	auto valid{ true };
+
+	group.forEach([&](ecs::Entity &entity, Position &position, Velocity &velocity)
+	{
+		valid = valid && position.x == static_cast<float>(entity.getId());
+		valid = valid && velocity.dx == static_cast<float>(entity.getId()) * 2.f;
+		valid = valid && &entity.getComponent<Position>() == &position;
+		++count;
+	});
+
+	return valid && count == expected && group.getEntityCount() == expected;
+}
+
+lest::test const specification[] =
+{
+	CASE("A Group gathers the existing Entities having all its Components")
+	{
+		ecs::World world;
+
+		for (int i{ 0 }; i < 10; ++i)
+		{
+			auto entity{ world.createEntity() };
+			entity.addComponent<Position>(static_cast<float>(entity.getId()));
+
+			if (i % 2 == 0)
+			{
+				entity.addComponent<Velocity>(static_cast<float>(entity.getId()) * 2.f);
+			}
+		}
+
+		ecs::Group<Position, Velocity> group{ world };
+
+		EXPECT(checkGroup(group, 5u));
+	},
+
+	CASE("The Components of a Group are iterated in lockstep")
+	{
+		ecs::World world;
+		ecs::Group<Position, Velocity> group{ world };
+
+		for (int i{ 0 }; i < 100; ++i)
+		{
+			auto entity{ world.createEntity() };
+
+			// Interleave the Entities which have only one of the Components
+			entity.addComponent<Position>(static_cast<float>(entity.getId()));
+			world.createEntity().addComponent<Velocity>();
+			entity.addComponent<Velocity>(static_cast<float>(entity.getId()) * 2.f);
+		}
+
+		Position *previous{ nullptr };
+		auto contiguous{ true };
+
+		group.forEach([&](ecs::Entity &, Position &position, Velocity &)
+		{
+			contiguous = contiguous && (previous == nullptr || &position == previous + 1);
+			previous = &position;
+		});
+
+		EXPECT(contiguous);
+		EXPECT(checkGroup(group, 100u));
+	},
+
+	CASE("Entities join and leave a Group as their Components change")
+	{
+		ecs::World world;
+		ecs::Group<Position, Velocity> group{ world };
+
+		std::vector<ecs::Entity> entities;
+
+		for (int i{ 0 }; i < 20; ++i)
+		{
+			auto entity{ world.createEntity() };
+			entity.addComponent<Position>(static_cast<float>(entity.getId()));
+			entity.addComponent<Velocity>(static_cast<float>(entity.getId()) * 2.f);
+			entities.push_back(entity);
+		}
+
+		EXPECT(checkGroup(group, 20u));
+
+		entities[3].removeComponent<Velocity>();
+		entities[0].removeComponent<Position>();
+		EXPECT(checkGroup(group, 18u));
+
+		// Replacing a Component keeps the Entity in the Group
+		entities[7].addComponent<Position>(static_cast<float>(entities[7].getId()));
+		EXPECT(checkGroup(group, 18u));
+
+		entities[3].addComponent<Velocity>(static_cast<float>(entities[3].getId()) * 2.f);
+		EXPECT(checkGroup(group, 19u));
+
+		entities[10].remove();
+		world.update(0.f);
+		EXPECT(checkGroup(group, 18u));
+	},
+
+	CASE("Groups can span several pages and hold non-trivial Components")
+	{
+		ecs::World world;
+		ecs::Group<Large, Label> group{ world };
+
+		std::vector<ecs::Entity> entities;
+
+		for (int i{ 0 }; i < 200; ++i)
+		{
+			auto entity{ world.createEntity() };
+			entity.addComponent<Large>(i);
+
+			if (i % 3 != 0)
+			{
+				entity.addComponent<Label>(std::to_string(i));
+			}
+
+			entities.push_back(entity);
+		}
+
+		for (int i{ 0 }; i < 200; i += 5)
+		{
+			entities[static_cast<std::size_t>(i)].removeComponent<Large>();
+		}
+
+		std::size_t count{ 0 };
+		auto valid{ true };
+
+		group.forEach([&](ecs::Entity &, Large &large, Label &label)
+		{
+			valid = valid && label.text == std::to_string(large.value);
+			++count;
+		});
+
+		EXPECT(valid);
+		EXPECT(count == group.getEntityCount());
+		EXPECT(count == 200u - 67u - 40u + 14u);
+	},
+
+	CASE("Groups are rebuilt after the World is restored")
+	{
+		ecs::World world;
+		ecs::Group<Position, Velocity> group{ world };
+
+		for (int i{ 0 }; i < 10; ++i)
+		{
+			auto entity{ world.createEntity() };
+			entity.addComponent<Position>(static_cast<float>(entity.getId()));
+			entity.addComponent<Velocity>(static_cast<float>(entity.getId()) * 2.f);
+		}
+
+		world.update(0.f);
+
+		ecs::WorldState state;
+		world.saveState(state);
+
+		world.getEntity(2)->removeComponent<Velocity>();
+		world.getEntity(5)->remove();
+		world.update(0.f);
+		EXPECT(checkGroup(group, 8u));
+
+		world.restoreState(state);
+		EXPECT(checkGroup(group, 10u));
+	},
+
+	CASE("A Component type can only be owned by one Group")
+	{
+		ecs::World world;
+		ecs::Group<Position, Velocity> group{ world };
+
+		// The same Components share the same group
+		ecs::Group<Position, Velocity> same{ world };
+		EXPECT(same.getEntityCount() == group.getEntityCount());
+
+		EXPECT_THROWS(ecs::Group<Position>{ world });
+		EXPECT_NO_THROW(ecs::Group<Label>{ world });
+	},
+
+	CASE("Adding a Component returns it after the Entity joins the Group")
+	{
+		ecs::World world;
+		ecs::Group<Position, Velocity> group{ world };
+
+		auto a{ world.createEntity() };
+		a.addComponent<Position>(1.f);
+
+		auto b{ world.createEntity() };
+		b.addComponent<Velocity>(2.f);
+
+		// b joins the group, its Position is swapped with the one of a
+		auto &position{ b.addComponent<Position>(2.f) };
+		position.x = 99.f;
+
+		EXPECT(a.getComponent<Position>().x == 1.f);
+		EXPECT(b.getComponent<Position>().x == 99.f);
+		EXPECT(&b.getComponent<Position>() == &position);
+	},
+
+	CASE("The modifications made through a Group are in the deltas")
+	{
+		ecs::ComponentRegistry registry;
+		registry.registerComponent<Position>(1);
+		registry.registerComponent<Velocity>(2);
+
+		ecs::World world;
+		ecs::World replica;
+		ecs::Group<Position, Velocity> group{ world };
+
+		for (int i{ 0 }; i < 10; ++i)
+		{
+			auto entity{ world.createEntity() };
+			entity.addComponent<Position>(static_cast<float>(entity.getId()));
+			entity.addComponent<Velocity>(1.f);
+		}
+
+		world.update(0.f);
+
+		std::stringstream snapshot;
+		ecs::SnapshotWriter{ registry }.write(world, snapshot);
+		ecs::SnapshotReader{ registry }.read(replica, snapshot);
+		replica.update(0.f);
+
+		ecs::WorldState baseline;
+		world.saveState(baseline);
+
+		group.forEach([](ecs::Entity &, Position &position, Velocity &velocity)
+		{
+			position.x += velocity.dx;
+		});
+
+		std::stringstream delta;
+		ecs::DeltaWriter{ registry }.write(world, baseline, delta);
+		ecs::DeltaReader{ registry }.apply(replica, delta);
+		replica.update(0.f);
+
+		auto valid{ true };
+
+		for (ecs::Entity::Id id{ 0 }; id < 10; ++id)
+		{
+			valid = valid && replica.getEntity(id)->getComponent<Position>().x == static_cast<float>(id) + 1.f;
+		}
+
+		EXPECT(valid);
+	}
+};
+
+int main(int argc, char **argv)
+{
+	return lest::run(specification, argc, argv);
+}
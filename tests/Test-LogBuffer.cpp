@@ -0,0 +1,114 @@
+// Copyright (c) 2021 Ethan Margaillan <contact@ethan.jp>.
+// Licensed under the MIT License - https://raw.githubusercontent.com/Ethan13310/ECS/master/LICENSE
+
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <ECS.hpp>
+#include <ECS/Detail/LogBuffer.hpp>
+#include <lest/lest.hpp>
+
+lest::test const specification[] =
+{
+	CASE("Push and consume messages")
+	{
+		ecs::detail::LogBuffer buffer{ 3 };
+
+		EXPECT(buffer.capacity() == 4);
+		EXPECT(buffer.empty());
+
+		EXPECT(buffer.push(0, "First"));
+		EXPECT(buffer.push(3, "Second"));
+		EXPECT_NOT(buffer.empty());
+
+		std::vector<std::string> messages;
+
+		auto const count{ buffer.consume([&](ecs::detail::LogBuffer::Record const &record)
+		{
+			messages.emplace_back(record.message);
+		}) };
+
+		EXPECT(count == 2);
+		EXPECT(messages.size() == 2);
+		EXPECT(messages[0] == "First");
+		EXPECT(messages[1] == "Second");
+		EXPECT(buffer.empty());
+	},
+
+	CASE("Drop messages when full")
+	{
+		ecs::detail::LogBuffer buffer{ 4 };
+
+		for (int i{ 0 }; i < 4; ++i)
+		{
+			EXPECT(buffer.push(0, std::to_string(i)));
+		}
+
+		EXPECT_NOT(buffer.push(0, "Dropped"));
+
+		std::string last;
+
+		buffer.consume([&](ecs::detail::LogBuffer::Record const &record)
+		{
+			last = record.message;
+		});
+
+		EXPECT(last == "3");
+
+		// The cells are reused
+		EXPECT(buffer.push(0, "Next"));
+	},
+
+	CASE("Push from several threads")
+	{
+		ecs::detail::LogBuffer buffer{ 1024 };
+		std::vector<std::thread> threads;
+
+		for (int t{ 0 }; t < 4; ++t)
+		{
+			threads.emplace_back([&buffer]
+			{
+				for (int i{ 0 }; i < 2000; ++i)
+				{
+					while (!buffer.push(0, "Message"))
+					{
+						std::this_thread::yield();
+					}
+				}
+			});
+		}
+
+		std::size_t count{ 0 };
+
+		while (count < 8000)
+		{
+			count += buffer.consume([](ecs::detail::LogBuffer::Record const &) {});
+		}
+
+		for (auto &thread : threads)
+		{
+			thread.join();
+		}
+
+		EXPECT(count == 8000);
+		EXPECT(buffer.empty());
+	},
+
+	CASE("Asynchronous logging")
+	{
+		ecs::Log::enableAsync();
+		EXPECT(ecs::Log::asyncEnabled());
+
+		ecs::Log::info("Asynchronous message");
+		ecs::Log::flush();
+
+		ecs::Log::enableAsync(false);
+		EXPECT_NOT(ecs::Log::asyncEnabled());
+	}
+};
+
+int main(int argc, char **argv)
+{
+	return lest::run(specification, argc, argv);
+}
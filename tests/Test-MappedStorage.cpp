@@ -0,0 +1,194 @@
+// Copyright (c) 2021 Ethan Margaillan <contact@ethan.jp>.
+// Licensed under the MIT License - https://raw.githubusercontent.com/Ethan13310/ECS/master/LICENSE
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <string>
+
+#include <ECS.hpp>
+#include <ECS/Exceptions/InvalidSnapshot.hpp>
+#include <lest/lest.hpp>
+
+struct Position : public ecs::Component
+{
+	Position(float x = 0.f, float y = 0.f) : x{ x }, y{ y } {}
+
+	float x;
+	float y;
+};
+
+struct Health : public ecs::Component
+{
+	Health(int val = 0) : value{ val } {}
+
+	int value;
+};
+
+class HealthSystem : public ecs::System
+{
+public:
+	HealthSystem()
+	{
+		getFilter().require<Health>();
+	}
+};
+
+ecs::ComponentRegistry makeRegistry()
+{
+	ecs::ComponentRegistry registry;
+
+	registry.registerComponent<Position>(1);
+	registry.registerComponent<Health>(2);
+
+	return registry;
+}
+
+std::string readFile(std::string const &path)
+{
+	std::ifstream stream{ path, std::ios::binary };
+
+	return std::string{ std::istreambuf_iterator<char>{ stream }, std::istreambuf_iterator<char>{} };
+}
+
+std::string const PATH{ "Test-MappedStorage.ecsm" };
+
+lest::test const specification[] =
+{
+	CASE("Save and open a mapped World")
+	{
+		auto const registry{ makeRegistry() };
+
+		{
+			ecs::World world;
+
+			for (int i{ 0 }; i < 5000; ++i)
+			{
+				auto entity{ world.createEntity() };
+				entity.addComponent<Health>(i);
+
+				if (i % 2 == 0)
+				{
+					entity.addComponent<Position>(static_cast<float>(i), 1.f);
+				}
+			}
+
+			world.createEntity("Named");
+			world.getEntity(3)->disable();
+			world.getEntity(4)->remove();
+			world.update(0);
+
+			ecs::MappedStorage{ registry }.save(world, PATH);
+		}
+
+		auto const content{ readFile(PATH) };
+
+		{
+			ecs::World world;
+			world.addSystem<HealthSystem>();
+
+			ecs::MappedStorage{ registry }.open(world, PATH);
+			world.update(0);
+
+			EXPECT(world.getEntity("Named")->getId() == 5000);
+			EXPECT_NOT(world.isEntityEnabled(3));
+			EXPECT_NOT(world.isEntityValid(4));
+
+			EXPECT(world.getEntity(4998)->getComponent<Health>().value == 4998);
+			EXPECT(world.getEntity(4998)->getComponent<Position>().x == 4998.f);
+			EXPECT_NOT(world.getEntity(4999)->hasComponent<Position>());
+
+			// Disabled Entities are not attached to the Systems
+			EXPECT(world.getSystem<HealthSystem>().getEntityCount() == 4998);
+
+			// The Components can be modified, replaced and added
+			world.getEntity(0)->getComponent<Health>().value = -1;
+			world.getEntity(2)->addComponent<Health>(-2);
+			world.getEntity(1)->removeComponent<Health>();
+			world.createEntity().addComponent<Health>(-3);
+			world.update(0);
+
+			EXPECT(world.getEntity(0)->getComponent<Health>().value == -1);
+			EXPECT(world.getEntity(2)->getComponent<Health>().value == -2);
+			EXPECT(world.getEntity(4)->getComponent<Health>().value == -3);
+			EXPECT_NOT(world.getEntity(1)->hasComponent<Health>());
+
+			// The file is never modified
+			EXPECT(readFile(PATH) == content);
+		}
+
+		std::remove(PATH.c_str());
+	},
+
+	CASE("Open an invalid mapped file")
+	{
+		auto const registry{ makeRegistry() };
+
+		{
+			std::ofstream stream{ PATH, std::ios::binary };
+			stream << "Not a mapped World";
+		}
+
+		ecs::World world;
+		world.createEntity("Kept");
+
+		EXPECT_THROWS(ecs::MappedStorage{ registry }.open(world, PATH));
+		EXPECT(world.getEntity("Kept").has_value());
+
+		std::remove(PATH.c_str());
+
+		EXPECT_THROWS(ecs::MappedStorage{ registry }.open(world, PATH));
+	},
+
+	CASE("Counts are checked against the size of the mapped file")
+	{
+		auto const registry{ makeRegistry() };
+
+		{
+			ecs::World world;
+			world.createEntity().addComponent<Health>(1);
+			world.update(0);
+
+			ecs::MappedStorage{ registry }.save(world, PATH);
+		}
+
+		auto const content{ readFile(PATH) };
+
+		// Far more free IDs, then far more columns, than the file holds
+		for (std::size_t const countOffset : { 40u, 72u })
+		{
+			auto corrupted{ content };
+			std::uint64_t const count{ std::uint64_t{ 1 } << 60 };
+			std::memcpy(&corrupted[countOffset], &count, sizeof(count));
+
+			{
+				std::ofstream stream{ PATH, std::ios::binary | std::ios::trunc };
+				stream << corrupted;
+			}
+
+			ecs::World world;
+			auto rejected{ false };
+
+			try
+			{
+				ecs::MappedStorage{ registry }.open(world, PATH);
+			}
+			catch (ecs::InvalidSnapshot const &)
+			{
+				// Not a failed allocation
+				rejected = true;
+			}
+
+			EXPECT(rejected);
+		}
+
+		std::remove(PATH.c_str());
+	}
+};
+
+int main(int argc, char **argv)
+{
+	return lest::run(specification, argc, argv);
+}
@@ -0,0 +1,119 @@
+// Copyright (c) 2021 Ethan Margaillan <contact@ethan.jp>.
+// Licensed under the MIT License - https://raw.githubusercontent.com/Ethan13310/ECS/master/LICENSE
+
+#include <cstddef>
+#include <memory_resource>
+
+#include <ECS.hpp>
+#include <lest/lest.hpp>
+
+// Memory resource counting the memory it holds
+class CountingResource : public std::pmr::memory_resource
+{
+public:
+	std::size_t allocated{ 0 };
+	std::size_t held{ 0 };
+
+private:
+	void *do_allocate(std::size_t bytes, std::size_t alignment) override
+	{
+		allocated += bytes;
+		held += bytes;
+
+		return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+	}
+
+	void do_deallocate(void *p, std::size_t bytes, std::size_t alignment) override
+	{
+		held -= bytes;
+
+		std::pmr::new_delete_resource()->deallocate(p, bytes, alignment);
+	}
+
+	bool do_is_equal(std::pmr::memory_resource const &other) const noexcept override
+	{
+		return this == &other;
+	}
+};
+
+struct Position : public ecs::Component
+{
+	float x{ 0.f };
+	float y{ 0.f };
+};
+
+class PositionSystem : public ecs::System
+{
+public:
+	PositionSystem()
+	{
+		getFilter().require<Position>();
+	}
+
+	void onStart() override
+	{
+		connectEvent<ecs::Event>([](ecs::Event const &) {});
+	}
+};
+
+lest::test const specification[] =
+{
+	CASE("Default memory resource")
+	{
+		ecs::World world;
+
+		EXPECT(world.getMemoryResource() == std::pmr::get_default_resource());
+	},
+
+	CASE("World memory is allocated from its resource")
+	{
+		CountingResource resource;
+
+		{
+			ecs::World world{ &resource };
+
+			EXPECT(world.getMemoryResource() == &resource);
+
+			world.addSystem<PositionSystem>();
+
+			for (int i{ 0 }; i < 100; ++i)
+			{
+				world.createEntity("Entity" + std::to_string(i)).addComponent<Position>();
+			}
+
+			world.update(0.f);
+
+			EXPECT(world.getSystem<PositionSystem>().getEntityCount() == 100u);
+
+			// The Components pages are allocated from the resource
+			EXPECT(resource.allocated >= ecs::detail::ComponentPool::PAGE_SIZE);
+		}
+
+		// Everything has been given back to the resource
+		EXPECT(resource.held == 0u);
+	},
+
+	CASE("Monotonic resource")
+	{
+		std::pmr::monotonic_buffer_resource resource;
+
+		ecs::World world{ &resource };
+
+		world.addSystem<PositionSystem>();
+
+		auto entity{ world.createEntity() };
+		auto &position{ entity.addComponent<Position>() };
+
+		position.x = 2.f;
+
+		world.update(0.f);
+
+		EXPECT(entity.getComponent<Position>().x == 2.f);
+		EXPECT(world.getSystem<PositionSystem>().getEntityCount() == 1u);
+	}
+};
+
+int main(int argc, char **argv)
+{
+	return lest::run(specification, argc, argv);
+}
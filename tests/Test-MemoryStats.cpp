@@ -0,0 +1,121 @@
+// Copyright (c) 2021 Ethan Margaillan <contact@ethan.jp>.
+// Licensed under the MIT License - https://raw.githubusercontent.com/Ethan13310/ECS/master/LICENSE
+
+#include <ECS.hpp>
+#include <lest/lest.hpp>
+
+struct Position : public ecs::Component
+{
+	float x{ 0.f };
+	float y{ 0.f };
+};
+
+struct Health : public ecs::Component
+{
+	int value{ 0 };
+};
+
+class PositionSystem : public ecs::System
+{
+public:
+	PositionSystem()
+	{
+		getFilter().require<Position>();
+	}
+
+	void onStart() override
+	{
+		connectEvent<ecs::Event>([](ecs::Event const &) {});
+	}
+};
+
+lest::test const specification[] =
+{
+	CASE("Empty World")
+	{
+		ecs::World world;
+
+		auto const stats{ world.memoryStats() };
+
+		EXPECT(stats.components.empty());
+		EXPECT(stats.systems.empty());
+		EXPECT(stats.entities.used == 0);
+		EXPECT(stats.names.used == 0);
+	},
+
+	CASE("Memory per Component type and per System")
+	{
+		ecs::World world;
+		world.addSystem<PositionSystem>();
+
+		for (int i{ 0 }; i < 1000; ++i)
+		{
+			auto entity{ world.createEntity() };
+			entity.addComponent<Position>();
+
+			if (i % 10 == 0)
+			{
+				entity.addComponent<Health>();
+			}
+		}
+
+		world.createEntity("Named");
+		world.update(0);
+
+		auto const stats{ world.memoryStats() };
+
+		EXPECT(stats.components.size() == 2);
+
+		for (auto const &component : stats.components)
+		{
+			auto const expected{ component.typeId == ecs::getComponentTypeId<Position>() ? 1000u : 100u };
+
+			EXPECT(component.count == expected);
+			EXPECT(component.memory.used >= component.count * sizeof(Position));
+			EXPECT(component.memory.reserved >= component.memory.used);
+		}
+
+		EXPECT(stats.systems.size() == 1);
+		EXPECT(stats.systems[0].name == "PositionSystem");
+		EXPECT(stats.systems[0].entityCount == 1000);
+		EXPECT(stats.systems[0].memory.used >= 1000 * sizeof(ecs::Entity));
+
+		EXPECT(stats.entities.used >= 1001);
+		EXPECT(stats.names.used > 0);
+		EXPECT(stats.events.used > 0);
+
+		auto const total{ stats.total() };
+
+		EXPECT(total.used > stats.entities.used);
+		EXPECT(total.reserved >= total.used);
+	},
+
+	CASE("IDs of the removed Entities")
+	{
+		ecs::World world;
+
+		for (int i{ 0 }; i < 100; ++i)
+		{
+			world.createEntity();
+		}
+
+		EXPECT(world.memoryStats().entityIds.used == 0);
+
+		for (ecs::Entity::Id id{ 0 }; id < 100; id += 2)
+		{
+			world.getEntity(id)->remove();
+		}
+
+		world.update(0);
+
+		auto const stats{ world.memoryStats() };
+
+		EXPECT(stats.entityIds.used == 50 * sizeof(ecs::Entity::Id));
+		EXPECT(stats.total().used >= stats.entities.used + stats.entityIds.used);
+	}
+};
+
+int main(int argc, char **argv)
+{
+	return lest::run(specification, argc, argv);
+}
@@ -0,0 +1,92 @@
+// Copyright (c) 2021 Ethan Margaillan <contact@ethan.jp>.
+// Licensed under the MIT License - https://raw.githubusercontent.com/Ethan13310/ECS/master/LICENSE
+
+#include <string>
+
+#include <ECS.hpp>
+#include <lest/lest.hpp>
+
+lest::test const specification[] =
+{
+	CASE("Insert and find names")
+	{
+		ecs::detail::NameTable names;
+
+		EXPECT(names.insert(0, "First"));
+		EXPECT(names.insert(2, "Second"));
+
+		EXPECT(names.find("First").value() == 0);
+		EXPECT(names.find(ecs::HashedName{ "Second" }).value() == 2);
+		EXPECT_NOT(names.find("Third").has_value());
+
+		EXPECT(names.getName(0).value() == "First");
+		EXPECT_NOT(names.getName(1).has_value());
+		EXPECT(names.size() == 2);
+
+		// Name already used by another Entity
+		EXPECT_NOT(names.insert(1, "First"));
+		EXPECT_NOT(names.getName(1).has_value());
+	},
+
+	CASE("Rename and erase names")
+	{
+		ecs::detail::NameTable names;
+
+		names.insert(0, "Old");
+		names.insert(0, "New");
+
+		EXPECT_NOT(names.find("Old").has_value());
+		EXPECT(names.find("New").value() == 0);
+
+		names.erase(0);
+		names.erase(5);
+
+		EXPECT_NOT(names.find("New").has_value());
+		EXPECT(names.size() == 0);
+	},
+
+	CASE("Many names")
+	{
+		ecs::detail::NameTable names;
+
+		for (ecs::Entity::Id id{ 0 }; id < 2000; ++id)
+		{
+			names.insert(id, "Entity" + std::to_string(id));
+		}
+
+		// Erasing and renaming reuses the index and compacts the names
+		for (ecs::Entity::Id id{ 0 }; id < 2000; id += 2)
+		{
+			names.erase(id);
+			names.insert(id + 1, "Renamed" + std::to_string(id + 1));
+		}
+
+		EXPECT(names.size() == 1000);
+		EXPECT_NOT(names.find("Entity0").has_value());
+		EXPECT_NOT(names.find("Entity1").has_value());
+		EXPECT(names.find("Renamed1999").value() == 1999);
+		EXPECT(names.getName(1001).value() == "Renamed1001");
+	},
+
+	CASE("Precomputed hashes")
+	{
+		constexpr ecs::HashedName player{ "Player" };
+		static_assert(player.getHash() == ecs::HashedName::hash("Player"));
+
+		ecs::World world;
+		auto entity{ world.createEntity(std::string{ "Player" }) };
+
+		EXPECT(world.getEntity(player)->getId() == entity.getId());
+		EXPECT(world.getEntity(std::string_view{ "Player" })->getId() == entity.getId());
+
+		entity.remove();
+		world.update(0);
+
+		EXPECT_NOT(world.getEntity(player).has_value());
+	}
+};
+
+int main(int argc, char **argv)
+{
+	return lest::run(specification, argc, argv);
+}
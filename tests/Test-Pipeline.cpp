@@ -0,0 +1,168 @@
+// Copyright (c) 2021 Ethan Margaillan <contact@ethan.jp>.
+// Licensed under the MIT License - https://raw.githubusercontent.com/Ethan13310/ECS/master/LICENSE
+
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <ECS.hpp>
+#include <lest/lest.hpp>
+
+struct Position : public ecs::Component
+{
+	Position(float x = 0.f) : x{ x } {}
+
+	float x;
+};
+
+std::vector<std::string> calls;
+
+class MoveSystem : public ecs::System
+{
+public:
+	MoveSystem()
+	{
+		getFilter().require<Position>();
+	}
+
+	void onUpdate(float elapsed) override
+	{
+		calls.push_back("Move::onUpdate");
+
+		forEach([elapsed](ecs::Entity entity) {
+			entity.getComponent<Position>().x += elapsed;
+		});
+	}
+
+	void onPostUpdate(float) override
+	{
+		calls.push_back("Move::onPostUpdate");
+	}
+};
+
+class RenderSystem final : public ecs::System
+{
+public:
+	void onUpdate(float) override
+	{
+		calls.push_back("Render::onUpdate");
+	}
+
+	void onPostUpdate(float) override
+	{
+		calls.push_back("Render::onPostUpdate");
+	}
+};
+
+class FailingSystem : public ecs::System
+{
+public:
+	void onUpdate(float) override
+	{
+		throw std::runtime_error{ "Failure" };
+	}
+};
+
+lest::test const specification[] =
+{
+	CASE("The Systems are updated in order by the Pipeline only")
+	{
+		calls.clear();
+
+		ecs::World world;
+
+		world.addSystem<RenderSystem>();
+		world.addSystem<MoveSystem>();
+
+		auto entity{ world.createEntity() };
+		entity.addComponent<Position>();
+
+		{
+			ecs::Pipeline<MoveSystem, RenderSystem> pipeline{ world };
+
+			world.update(1.f);
+			EXPECT(calls.empty());
+
+			pipeline.update(2.f);
+
+			EXPECT(calls == (std::vector<std::string>{
+				"Move::onUpdate", "Render::onUpdate", "Move::onPostUpdate", "Render::onPostUpdate"
+			}));
+			EXPECT(entity.getComponent<Position>().x == 2.f);
+			EXPECT(&pipeline.getSystem<MoveSystem>() == &world.getSystem<MoveSystem>());
+		}
+
+		// The World updates the Systems again once the Pipeline is destroyed
+		calls.clear();
+		world.update(1.f);
+
+		EXPECT(calls.size() == 4u);
+		EXPECT(entity.getComponent<Position>().x == 3.f);
+	},
+
+	CASE("The Systems must exist")
+	{
+		ecs::World world;
+
+		EXPECT_THROWS(ecs::Pipeline<MoveSystem>{ world });
+	},
+
+	CASE("The error policy is configurable")
+	{
+		calls.clear();
+
+		ecs::World world;
+
+		world.addSystem<FailingSystem>();
+		world.addSystem<RenderSystem>();
+
+		ecs::Pipeline<FailingSystem, RenderSystem> reporting{ world };
+
+		EXPECT_NO_THROW(reporting.update(0.f));
+		EXPECT(world.getErrorReport().getCount("ecs::Pipeline::update()", "Failure") == 1u);
+		EXPECT(calls.size() == 2u);
+	},
+
+	CASE("Exceptions can be propagated")
+	{
+		calls.clear();
+
+		ecs::World world;
+
+		world.addSystem<FailingSystem>();
+		world.addSystem<RenderSystem>();
+
+		ecs::BasicPipeline<ecs::PropagateErrors, FailingSystem, RenderSystem> propagating{ world };
+
+		EXPECT_THROWS(propagating.update(0.f));
+		EXPECT(calls.empty());
+	},
+
+	CASE("A System can belong to several Pipelines")
+	{
+		calls.clear();
+
+		ecs::World world;
+
+		world.addSystem<MoveSystem>();
+		world.addSystem<RenderSystem>();
+
+		ecs::Pipeline<MoveSystem, RenderSystem> pipeline{ world };
+
+		{
+			ecs::BasicPipeline<ecs::PropagateErrors, RenderSystem> other{ world };
+		}
+
+		// The remaining Pipeline still updates RenderSystem
+		world.update(0.f);
+		EXPECT(calls.empty());
+
+		pipeline.update(0.f);
+		EXPECT(calls.size() == 4u);
+	}
+};
+
+int main(int argc, char **argv)
+{
+	return lest::run(specification, argc, argv);
+}
@@ -0,0 +1,175 @@
+// Copyright (c) 2021 Ethan Margaillan <contact@ethan.jp>.
+// Licensed under the MIT License - https://raw.githubusercontent.com/Ethan13310/ECS/master/LICENSE
+
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <string>
+
+#include <ECS.hpp>
+#include <lest/lest.hpp>
+
+struct Position : public ecs::Component
+{
+	float x{ 0.f };
+	float y{ 0.f };
+};
+
+class MovementSystem : public ecs::System
+{
+public:
+	MovementSystem()
+	{
+		getFilter().require<Position>();
+	}
+
+	void onUpdate(float) override
+	{
+		forEach([](ecs::Entity entity)
+		{
+			entity.getComponent<Position>().x += 1.f;
+		});
+	}
+};
+
+ecs::Profiler::Stats const *findStats(std::vector<ecs::Profiler::Stats> const &stats, std::string const &name)
+{
+	for (auto const &stat : stats)
+	{
+		if (stat.name == name)
+		{
+			return &stat;
+		}
+	}
+
+	return nullptr;
+}
+
+lest::test const specification[] =
+{
+	CASE("Disabled by default")
+	{
+		ecs::World world;
+		world.addSystem<MovementSystem>();
+		world.update(0);
+
+		EXPECT_NOT(world.getProfiler().isEnabled());
+		EXPECT(world.getProfiler().getStats().empty());
+	},
+
+	CASE("Statistics per System")
+	{
+		ecs::World world;
+		world.addSystem<MovementSystem>();
+		world.getProfiler().enable();
+
+		for (int i{ 0 }; i < 10; ++i)
+		{
+			world.createEntity().addComponent<Position>();
+		}
+
+		for (int i{ 0 }; i < 5; ++i)
+		{
+			world.update(0);
+		}
+
+		auto const stats{ world.getProfiler().getStats() };
+
+		auto const frame{ findStats(stats, "ecs::World::update") };
+		auto const update{ findStats(stats, "MovementSystem::onUpdate") };
+		auto const start{ findStats(stats, "MovementSystem::onStart") };
+
+		EXPECT(frame != nullptr);
+		EXPECT(update != nullptr);
+		EXPECT(start != nullptr);
+		EXPECT(findStats(stats, "ecs::World::updateEntities") != nullptr);
+
+		EXPECT(frame->calls == 5);
+		EXPECT(start->calls == 1);
+		EXPECT(update->calls == 5);
+		EXPECT(update->entityCount == 10);
+		EXPECT(update->min <= update->average);
+		EXPECT(update->average <= update->max);
+		EXPECT(update->p99 <= update->max);
+
+		// The whole frame is the longest step
+		EXPECT(stats.front().name == "ecs::World::update");
+
+		world.getProfiler().reset();
+
+		EXPECT(world.getProfiler().getStats().empty());
+	},
+
+	CASE("Chrome trace")
+	{
+		std::string const path{ "Test-Profiler.json" };
+
+		ecs::World world;
+		world.addSystem<MovementSystem>();
+		world.getProfiler().startTrace(path);
+
+		EXPECT(world.getProfiler().isTracing());
+
+		world.update(0);
+		world.update(0);
+		world.getProfiler().stopTrace();
+
+		EXPECT_NOT(world.getProfiler().isTracing());
+
+		std::ifstream stream{ path };
+		std::string const content{ std::istreambuf_iterator<char>{ stream }, std::istreambuf_iterator<char>{} };
+
+		EXPECT(content.find("\"traceEvents\"") != std::string::npos);
+		EXPECT(content.find("\"name\":\"MovementSystem::onUpdate\"") != std::string::npos);
+		EXPECT(content.find("\"ph\":\"X\"") != std::string::npos);
+
+		stream.close();
+		std::remove(path.c_str());
+	},
+
+	CASE("Hardware performance counters")
+	{
+		ecs::World world;
+		world.addSystem<MovementSystem>();
+		world.getProfiler().enable();
+
+		// The counters may not be available, the durations are measured anyway
+		auto const available{ world.getProfiler().enableCounters() };
+
+		EXPECT(world.getProfiler().countersEnabled() == available);
+
+		world.createEntity().addComponent<Position>();
+		world.update(0);
+
+		auto const stats{ world.getProfiler().getStats() };
+		auto const update{ findStats(stats, "MovementSystem::onUpdate") };
+
+		EXPECT(update != nullptr);
+		EXPECT(update->calls == 1);
+
+		if (!available)
+		{
+			EXPECT_NOT(update->counters.cycles.has_value());
+			EXPECT_NOT(update->counters.instructions.has_value());
+		}
+
+		EXPECT_NOT(world.getProfiler().enableCounters(false));
+		EXPECT_NOT(world.getProfiler().countersEnabled());
+
+		// The measures without counters do not count as 0 events
+		world.update(0);
+
+		auto const next{ world.getProfiler().getStats() };
+		auto const nextUpdate{ findStats(next, "MovementSystem::onUpdate") };
+
+		EXPECT(nextUpdate != nullptr);
+		EXPECT(nextUpdate->calls == 2);
+		EXPECT_NOT(nextUpdate->counters.cycles.has_value());
+		EXPECT(nextUpdate->averageCounters.instructions == update->averageCounters.instructions);
+	}
+};
+
+int main(int argc, char **argv)
+{
+	return lest::run(specification, argc, argv);
+}
@@ -0,0 +1,144 @@
+// Copyright (c) 2021 Ethan Margaillan <contact@ethan.jp>.
+// Licensed under the MIT License - https://raw.githubusercontent.com/Ethan13310/ECS/master/LICENSE
+
+#include <ECS.hpp>
+#include <lest/lest.hpp>
+
+struct Health : public ecs::Component
+{
+	Health(int value = 100) : value{ value } {}
+
+	int value;
+};
+
+struct Team : public ecs::Component {};
+struct Dead : public ecs::Component {};
+
+lest::test const specification[] =
+{
+	CASE("A Query is filled with the existing Entities")
+	{
+		ecs::World world;
+
+		auto first{ world.createEntity() };
+		first.addComponent<Health>();
+		first.addComponent<Team>();
+
+		auto second{ world.createEntity() };
+		second.addComponent<Health>();
+
+		world.update(0.f);
+
+		auto &query{ world.query<Health, Team>() };
+
+		EXPECT(query.getEntityCount() == 1u);
+		EXPECT(query.contains(first.getId()));
+		EXPECT_NOT(query.contains(second.getId()));
+	},
+
+	CASE("A Query is kept up to date by the World")
+	{
+		ecs::World world;
+
+		auto &query{ world.query<Health, ecs::Exclude<Dead>>() };
+
+		auto entity{ world.createEntity() };
+		entity.addComponent<Health>();
+
+		EXPECT(query.getEntityCount() == 0u);
+
+		world.update(0.f);
+		EXPECT(query.contains(entity.getId()));
+
+		entity.addComponent<Dead>();
+		world.update(0.f);
+		EXPECT_NOT(query.contains(entity.getId()));
+
+		entity.removeComponent<Dead>();
+		world.update(0.f);
+		EXPECT(query.contains(entity.getId()));
+
+		entity.disable();
+		world.update(0.f);
+		EXPECT_NOT(query.contains(entity.getId()));
+
+		entity.enable();
+		world.update(0.f);
+		EXPECT(query.contains(entity.getId()));
+
+		entity.remove();
+		world.update(0.f);
+		EXPECT(query.getEntityCount() == 0u);
+	},
+
+	CASE("Identical filters share the same Query")
+	{
+		ecs::World world;
+
+		auto &first{ world.query<Health, Team>() };
+		auto &second{ world.query<ecs::Require<Health, Team>>() };
+		auto &other{ world.query<Health>() };
+
+		EXPECT(&first == &second);
+		EXPECT(&first != &other);
+	},
+
+	CASE("Removing Entities keeps the others in the Query")
+	{
+		ecs::World world;
+
+		auto &query{ world.query<Health>() };
+
+		ecs::Entity entities[4];
+
+		for (auto &entity : entities)
+		{
+			entity = world.createEntity();
+			entity.addComponent<Health>();
+		}
+
+		world.update(0.f);
+
+		entities[1].remove();
+		world.update(0.f);
+
+		int sum{ 0 };
+
+		query.forEach([&](ecs::Entity const &entity) {
+			sum += static_cast<int>(entity.getId());
+		});
+
+		EXPECT(query.getEntityCount() == 3u);
+		EXPECT(sum == 0 + 2 + 3);
+		EXPECT_NOT(query.contains(entities[1].getId()));
+	},
+
+	CASE("A Query follows the restored states")
+	{
+		ecs::World world;
+		ecs::WorldState state;
+
+		auto &query{ world.query<Health>() };
+
+		auto entity{ world.createEntity() };
+		entity.addComponent<Health>();
+		world.update(0.f);
+
+		world.saveState(state);
+
+		entity.remove();
+		world.update(0.f);
+		EXPECT(query.getEntityCount() == 0u);
+
+		world.restoreState(state);
+		EXPECT(query.getEntityCount() == 1u);
+
+		world.clear();
+		EXPECT(query.getEntityCount() == 0u);
+	}
+};
+
+int main(int argc, char **argv)
+{
+	return lest::run(specification, argc, argv);
+}
@@ -0,0 +1,139 @@
+// Copyright (c) 2021 Ethan Margaillan <contact@ethan.jp>.
+// Licensed under the MIT License - https://raw.githubusercontent.com/Ethan13310/ECS/master/LICENSE
+
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <ECS.hpp>
+#include <lest/lest.hpp>
+
+struct Position : public ecs::Component
+{
+	Position(float x = 0.f) : x{ x } {}
+
+	float x;
+};
+
+class PositionSystem : public ecs::System
+{
+public:
+	PositionSystem()
+	{
+		getFilter().require<Position>();
+	}
+};
+
+lest::test const specification[] =
+{
+	CASE("Memory is released after removing Entities")
+	{
+		ecs::World world;
+
+		world.addSystem<PositionSystem>();
+
+		std::vector<ecs::Entity> entities;
+
+		for (int i{ 0 }; i < 5000; ++i)
+		{
+			auto entity{ world.createEntity("Entity" + std::to_string(i)) };
+			entity.addComponent<Position>(static_cast<float>(i));
+
+			entities.push_back(entity);
+		}
+
+		world.update(0.f);
+
+		auto const peak{ world.memoryStats().total().reserved };
+
+		for (std::size_t i{ 10 }; i < entities.size(); ++i)
+		{
+			entities[i].remove();
+		}
+
+		world.update(0.f);
+		world.shrinkToFit();
+
+		auto const stats{ world.memoryStats() };
+
+		EXPECT(stats.total().reserved * 4 < peak);
+		EXPECT(stats.components.size() == 1u);
+		EXPECT(stats.components[0].memory.reserved < 2 * ecs::detail::ComponentPool::PAGE_SIZE);
+
+		// The remaining Entities are untouched
+		EXPECT(world.getSystem<PositionSystem>().getEntityCount() == 10u);
+		EXPECT(world.getEntity("Entity9")->getComponent<Position>().x == 9.f);
+		EXPECT_NOT(world.getEntity("Entity10").has_value());
+		EXPECT_NOT(world.isEntityValid(entities[10].getId()));
+
+		// The trimmed IDs are given again
+		auto const entity{ world.createEntity() };
+
+		EXPECT(entity.getId() == 10u);
+	},
+
+	CASE("Removed Components release their pool")
+	{
+		ecs::World world;
+
+		auto entity{ world.createEntity() };
+		entity.addComponent<Position>();
+
+		world.update(0.f);
+
+		entity.removeComponent<Position>();
+
+		world.update(0.f);
+		world.shrinkToFit();
+
+		EXPECT(world.memoryStats().components.empty());
+		EXPECT(world.isEntityValid(entity.getId()));
+
+		entity.addComponent<Position>(3.f);
+
+		EXPECT(entity.getComponent<Position>().x == 3.f);
+	},
+
+	CASE("Deltas record the trimmed Entities")
+	{
+		ecs::ComponentRegistry registry;
+		registry.registerComponent<Position>(1);
+
+		ecs::World world;
+		ecs::World replica;
+
+		auto first{ world.createEntity() };
+		auto second{ world.createEntity() };
+
+		first.addComponent<Position>(1.f);
+		second.addComponent<Position>(2.f);
+
+		world.update(0.f);
+
+		std::stringstream snapshot;
+		ecs::SnapshotWriter{ registry }.write(world, snapshot);
+		ecs::SnapshotReader{ registry }.read(replica, snapshot);
+		replica.update(0.f);
+
+		ecs::WorldState baseline;
+		world.saveState(baseline);
+
+		second.remove();
+
+		world.update(0.f);
+		world.shrinkToFit();
+
+		std::stringstream delta;
+		ecs::DeltaWriter{ registry }.write(world, baseline, delta);
+		ecs::DeltaReader{ registry }.apply(replica, delta);
+		replica.update(0.f);
+
+		EXPECT(replica.isEntityValid(first.getId()));
+		EXPECT_NOT(replica.isEntityValid(second.getId()));
+	}
+};
+
+int main(int argc, char **argv)
+{
+	return lest::run(specification, argc, argv);
+}
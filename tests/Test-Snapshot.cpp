@@ -0,0 +1,341 @@
+// Copyright (c) 2021 Ethan Margaillan <contact@ethan.jp>.
+// Licensed under the MIT License - https://raw.githubusercontent.com/Ethan13310/ECS/master/LICENSE
+
+#include <cstdint>
+#include <sstream>
+#include <string>
+
+#include <ECS.hpp>
+#include <ECS/Exceptions/InvalidSnapshot.hpp>
+#include <lest/lest.hpp>
+
+struct Position : public ecs::Component
+{
+	Position(float x = 0.f, float y = 0.f) : x{ x }, y{ y } {}
+
+	float x;
+	float y;
+};
+
+struct Health : public ecs::Component
+{
+	Health(int val = 0) : value{ val } {}
+
+	int value;
+};
+
+struct Unregistered : public ecs::Component
+{};
+
+class PositionSystem : public ecs::System
+{
+public:
+	PositionSystem()
+	{
+		getFilter().require<Position>();
+	}
+};
+
+ecs::ComponentRegistry makeRegistry()
+{
+	ecs::ComponentRegistry registry;
+
+	registry.registerComponent<Position>(1);
+	registry.registerComponent<Health>(2);
+
+	return registry;
+}
+
+lest::test const specification[] =
+{
+	CASE("Component registry")
+	{
+		ecs::ComponentRegistry registry;
+
+		registry.registerComponent<Position>(10);
+
+		EXPECT(registry.isRegistered<Position>());
+		EXPECT_NOT(registry.isRegistered<Health>());
+
+		EXPECT(registry.getStableId(ecs::getComponentTypeId<Position>()).value() == 10);
+		EXPECT(registry.getInfo(10)->typeId == ecs::getComponentTypeId<Position>());
+		EXPECT(registry.getInfo(11) == nullptr);
+
+		// Same type, same ID
+		EXPECT_NO_THROW(registry.registerComponent<Position>(10));
+
+		// ID already used, type already registered
+		EXPECT_THROWS(registry.registerComponent<Health>(10));
+		EXPECT_THROWS(registry.registerComponent<Position>(11));
+	},
+
+	CASE("Save and load a World")
+	{
+		auto const registry{ makeRegistry() };
+		std::stringstream stream;
+
+		{
+			ecs::World world;
+
+			auto first{ world.createEntity("First") };
+			auto second{ world.createEntity() };
+			auto third{ world.createEntity("Third") };
+
+			first.addComponent<Position>(1.f, 2.f);
+			first.addComponent<Health>(100);
+			first.addComponent<Unregistered>();
+			third.addComponent<Health>(50);
+			third.disable();
+			second.remove();
+
+			world.update(0);
+
+			ecs::SnapshotWriter{ registry }.write(world, stream);
+		}
+
+		ecs::World world;
+		world.addSystem<PositionSystem>();
+		world.createEntity("Replaced");
+
+		ecs::SnapshotReader{ registry }.read(world, stream);
+		world.update(0);
+
+		EXPECT_NOT(world.getEntity("Replaced").has_value());
+		EXPECT_NOT(world.isEntityValid(1));
+
+		auto first{ world.getEntity("First").value() };
+		auto third{ world.getEntity("Third").value() };
+
+		EXPECT(first.getId() == 0);
+		EXPECT(third.getId() == 2);
+
+		EXPECT(first.isEnabled());
+		EXPECT_NOT(third.isEnabled());
+
+		EXPECT(first.getComponent<Position>().x == 1.f);
+		EXPECT(first.getComponent<Position>().y == 2.f);
+		EXPECT(first.getComponent<Health>().value == 100);
+		EXPECT(third.getComponent<Health>().value == 50);
+
+		EXPECT_NOT(first.hasComponent<Unregistered>());
+		EXPECT_NOT(third.hasComponent<Position>());
+
+		// The removed ID is reused first
+		EXPECT(world.createEntity().getId() == 1);
+
+		// The Entities are attached to the Systems
+		EXPECT(world.getSystem<PositionSystem>().getEntityCount() == 1);
+	},
+
+	CASE("Apply a delta")
+	{
+		auto const registry{ makeRegistry() };
+
+		ecs::World world;
+		ecs::World replica;
+
+		auto first{ world.createEntity("First") };
+		auto second{ world.createEntity() };
+		auto third{ world.createEntity() };
+
+		first.addComponent<Position>(1.f, 2.f);
+		second.addComponent<Health>(10);
+		third.addComponent<Health>(20);
+
+		world.update(0);
+
+		// The replica starts from the baseline
+		std::stringstream snapshot;
+		ecs::SnapshotWriter{ registry }.write(world, snapshot);
+		ecs::SnapshotReader{ registry }.read(replica, snapshot);
+		replica.update(0);
+
+		ecs::WorldState baseline;
+		world.saveState(baseline);
+
+		first.getComponent<Position>().x = 5.f;
+		first.removeComponent<Health>();
+		second.remove();
+		third.disable();
+
+		world.update(0);
+
+		auto fourth{ world.createEntity("Fourth") };
+		fourth.addComponent<Health>(40);
+
+		world.update(0);
+
+		std::stringstream delta;
+		ecs::DeltaWriter{ registry }.write(world, baseline, delta);
+		ecs::DeltaReader{ registry }.apply(replica, delta);
+		replica.update(0);
+
+		auto replicaFirst{ replica.getEntity("First").value() };
+		auto replicaFourth{ replica.getEntity("Fourth").value() };
+
+		EXPECT(replicaFirst.getComponent<Position>().x == 5.f);
+		EXPECT(replicaFirst.getComponent<Position>().y == 2.f);
+		EXPECT_NOT(replicaFirst.hasComponent<Health>());
+
+		EXPECT(replicaFourth.getId() == fourth.getId());
+		EXPECT(replicaFourth.getComponent<Health>().value == 40);
+
+		EXPECT_NOT(replica.isEntityEnabled(third.getId()));
+		EXPECT(replica.getEntity(third.getId())->getComponent<Health>().value == 20);
+
+		// The second Entity has been removed, then its ID has been reused
+		EXPECT(second.getId() == fourth.getId());
+	},
+
+	CASE("Apply a delta after the World has been cleared")
+	{
+		auto const registry{ makeRegistry() };
+
+		ecs::World world;
+		ecs::World replica;
+
+		world.createEntity().addComponent<Health>(10);
+		world.update(0);
+
+		ecs::WorldState baseline;
+		world.saveState(baseline);
+
+		world.getEntity(0)->getComponent<Health>().value = 11;
+		world.clear();
+
+		auto entity{ world.createEntity() };
+		entity.addComponent<Health>(20);
+		world.update(0);
+
+		// The baseline has been saved before the Entities have been reset
+		std::stringstream outdated;
+		EXPECT_THROWS(ecs::DeltaWriter{ registry }.write(world, baseline, outdated));
+
+		// The replica starts again from a new baseline
+		std::stringstream snapshot;
+		ecs::SnapshotWriter{ registry }.write(world, snapshot);
+		ecs::SnapshotReader{ registry }.read(replica, snapshot);
+		replica.update(0);
+
+		world.saveState(baseline);
+
+		entity.getComponent<Health>().value = 30;
+		world.createEntity().addComponent<Health>(40);
+		world.update(0);
+
+		std::stringstream delta;
+		ecs::DeltaWriter{ registry }.write(world, baseline, delta);
+		EXPECT_NO_THROW(ecs::DeltaReader{ registry }.apply(replica, delta));
+		replica.update(0);
+
+		EXPECT(replica.getEntity(0)->getComponent<Health>().value == 30);
+		EXPECT(replica.getEntity(1)->getComponent<Health>().value == 40);
+	},
+
+	CASE("Delta size depends on the modified Entities")
+	{
+		auto const registry{ makeRegistry() };
+
+		ecs::World world;
+
+		for (int i{ 0 }; i < 1000; ++i)
+		{
+			world.createEntity().addComponent<Health>(i);
+		}
+
+		world.update(0);
+
+		ecs::WorldState baseline;
+		world.saveState(baseline);
+
+		std::stringstream empty;
+		ecs::DeltaWriter{ registry }.write(world, baseline, empty);
+
+		world.getEntity(500)->getComponent<Health>().value = -1;
+
+		// Read-only access does not mark the Entity as modified
+		auto const entity{ world.getEntity(10).value() };
+		EXPECT(entity.getComponent<Health>().value == 10);
+
+		std::stringstream delta;
+		ecs::DeltaWriter{ registry }.write(world, baseline, delta);
+
+		std::stringstream snapshot;
+		ecs::SnapshotWriter{ registry }.write(world, snapshot);
+
+		EXPECT(delta.str().size() > empty.str().size());
+		EXPECT(delta.str().size() < empty.str().size() + 64);
+		EXPECT(delta.str().size() * 10 < snapshot.str().size());
+	},
+
+	CASE("Load an invalid snapshot")
+	{
+		auto const registry{ makeRegistry() };
+
+		ecs::World world;
+		auto entity{ world.createEntity("Entity") };
+
+		std::stringstream stream{ "not a snapshot" };
+
+		EXPECT_THROWS(ecs::SnapshotReader{ registry }.read(world, stream));
+
+		// The World has not been modified
+		EXPECT(entity.isValid());
+		EXPECT(world.getEntity("Entity").has_value());
+	},
+
+	CASE("Load a truncated snapshot")
+	{
+		auto const registry{ makeRegistry() };
+		std::stringstream stream;
+
+		{
+			ecs::World world;
+			world.createEntity().addComponent<Position>(1.f, 2.f);
+
+			ecs::SnapshotWriter{ registry }.write(world, stream);
+		}
+
+		auto const data{ stream.str() };
+		std::stringstream truncated{ data.substr(0, data.size() - 1) };
+
+		ecs::World world;
+
+		EXPECT_THROWS(ecs::SnapshotReader{ registry }.read(world, truncated));
+	},
+
+	CASE("Counts are checked against the size of the snapshot")
+	{
+		auto const registry{ makeRegistry() };
+
+		std::stringstream stream;
+		stream.write("ECSS", 4);
+
+		auto const version{ ecs::SNAPSHOT_VERSION };
+		stream.write(reinterpret_cast<char const*>(&version), sizeof(version));
+
+		// Far more Entities than the stream holds
+		std::uint64_t const count{ std::uint64_t{ 1 } << 60 };
+		stream.write(reinterpret_cast<char const*>(&count), sizeof(count));
+
+		ecs::World world;
+		auto rejected{ false };
+
+		try
+		{
+			ecs::SnapshotReader{ registry }.read(world, stream);
+		}
+		catch (ecs::InvalidSnapshot const &)
+		{
+			// Not a failed allocation
+			rejected = true;
+		}
+
+		EXPECT(rejected);
+	}
+};
+
+int main(int argc, char **argv)
+{
+	return lest::run(specification, argc, argv);
+}
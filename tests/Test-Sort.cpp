@@ -0,0 +1,274 @@
+// Copyright (c) 2021 Ethan Margaillan <contact@ethan.jp>.
+// Licensed under the MIT License - https://raw.githubusercontent.com/Ethan13310/ECS/master/LICENSE
+
+#include <algorithm>
+#include <functional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <ECS.hpp>
+#include <lest/lest.hpp>
+
+struct Depth : public ecs::Component
+{
+	Depth(int value = 0) : value{ value } {}
+
+	int value;
+};
+
+struct Name : public ecs::Component
+{
+	Name(std::string text = {}) : text{ std::move(text) } {}
+
+	std::string text;
+};
+
+struct Velocity : public ecs::Component
+{
+	Velocity(int dx = 0) : dx{ dx } {}
+
+	int dx;
+};
+
+class DepthSystem : public ecs::System
+{
+public:
+	DepthSystem()
+	{
+		getFilter().require<Depth>();
+	}
+};
+
+class NameSystem : public ecs::System
+{
+public:
+	NameSystem()
+	{
+		getFilter().require<Name>();
+	}
+};
+
+// Get the Entities ordered by the address of their Component T
+template <class T>
+std::vector<ecs::Entity> getStorageOrder(std::vector<ecs::Entity> entities)
+{
+	// The const access does not record the Entities as modified
+	std::sort(entities.begin(), entities.end(), [](ecs::Entity const &lhs, ecs::Entity const &rhs)
+	{
+		return std::less<T const *>{}(&lhs.getComponent<T>(), &rhs.getComponent<T>());
+	});
+
+	return entities;
+}
+
+bool lessDepth(Depth const &lhs, Depth const &rhs)
+{
+	return lhs.value < rhs.value;
+}
+
+lest::test const specification[] =
+{
+	CASE("Sorting Components orders their storage")
+	{
+		ecs::World world;
+		std::vector<ecs::Entity> entities;
+
+		for (int i{ 0 }; i < 100; ++i)
+		{
+			auto entity{ world.createEntity() };
+			entity.addComponent<Depth>((i * 37) % 10);
+			entities.push_back(entity);
+		}
+
+		world.sort<Depth>(lessDepth);
+
+		auto const order{ getStorageOrder<Depth>(entities) };
+		auto sorted{ true };
+
+		for (std::size_t i{ 1 }; i < order.size(); ++i)
+		{
+			auto const &previous{ order[i - 1] };
+			auto const &current{ order[i] };
+			auto const previousDepth{ previous.getComponent<Depth>().value };
+			auto const currentDepth{ current.getComponent<Depth>().value };
+
+			// Equivalent Components keep their relative order
+			sorted = sorted && (previousDepth < currentDepth || (previousDepth == currentDepth && previous.getId() < current.getId()));
+		}
+
+		EXPECT(sorted);
+	},
+
+	CASE("Sorting Components fills the free slots")
+	{
+		ecs::World world;
+		std::vector<ecs::Entity> entities;
+
+		for (int i{ 0 }; i < 50; ++i)
+		{
+			auto entity{ world.createEntity() };
+			entity.addComponent<Name>(std::to_string(i));
+			entities.push_back(entity);
+		}
+
+		for (std::size_t i{ 0 }; i < entities.size(); i += 3)
+		{
+			entities[i].removeComponent<Name>();
+		}
+
+		world.sort<Name>([](Name const &lhs, Name const &rhs)
+		{
+			return lhs.text > rhs.text;
+		});
+
+		for (std::size_t i{ 0 }; i < entities.size(); i += 3)
+		{
+			entities[i].addComponent<Name>(std::to_string(i));
+		}
+
+		auto valid{ true };
+
+		for (std::size_t i{ 0 }; i < entities.size(); ++i)
+		{
+			valid = valid && entities[i].getComponent<Name>().text == std::to_string(i);
+		}
+
+		EXPECT(valid);
+	},
+
+	CASE("Nearly sorted Components can be sorted incrementally")
+	{
+		ecs::World world;
+		std::vector<ecs::Entity> entities;
+
+		for (int i{ 0 }; i < 100; ++i)
+		{
+			auto entity{ world.createEntity() };
+			entity.addComponent<Depth>(100 - i);
+			entities.push_back(entity);
+		}
+
+		world.sort<Depth>(lessDepth);
+
+		entities[10].getComponent<Depth>().value = 1000;
+		entities[50].getComponent<Depth>().value = -1;
+
+		world.sort<Depth>(lessDepth, ecs::SortMode::Incremental);
+
+		auto const order{ getStorageOrder<Depth>(entities) };
+
+		EXPECT(order.front().getId() == entities[50].getId());
+		EXPECT(order.back().getId() == entities[10].getId());
+		EXPECT(std::is_sorted(order.begin(), order.end(), [](ecs::Entity const &lhs, ecs::Entity const &rhs)
+		{
+			return lhs.getComponent<Depth>().value < rhs.getComponent<Depth>().value;
+		}));
+	},
+
+	CASE("Sorting an owned Component sorts its Group")
+	{
+		ecs::World world;
+		ecs::Group<Depth, Velocity> group{ world };
+
+		for (int i{ 0 }; i < 30; ++i)
+		{
+			auto entity{ world.createEntity() };
+			entity.addComponent<Depth>(i);
+
+			if (i % 4 != 0)
+			{
+				entity.addComponent<Velocity>(i * 2);
+			}
+		}
+
+		world.sort<Depth>([](Depth const &lhs, Depth const &rhs)
+		{
+			return lhs.value > rhs.value;
+		});
+
+		std::vector<int> depths;
+		auto valid{ true };
+
+		group.forEach([&](ecs::Entity &, Depth &depth, Velocity &velocity)
+		{
+			valid = valid && velocity.dx == depth.value * 2;
+			depths.push_back(depth.value);
+		});
+
+		EXPECT(valid);
+		EXPECT(depths.size() == 22u);
+		EXPECT(std::is_sorted(depths.rbegin(), depths.rend()));
+	},
+
+	CASE("A System can sort its Entities")
+	{
+		ecs::World world;
+		auto &system{ world.addSystem<DepthSystem>() };
+
+		for (int i{ 0 }; i < 20; ++i)
+		{
+			world.createEntity().addComponent<Depth>((i * 7) % 20);
+		}
+
+		world.update(0.f);
+		system.sort<Depth>(lessDepth);
+
+		std::vector<int> depths;
+
+		system.forEach([&](ecs::Entity const &entity)
+		{
+			depths.push_back(entity.getComponent<Depth>().value);
+		});
+
+		EXPECT(depths.size() == 20u);
+		EXPECT(std::is_sorted(depths.begin(), depths.end()));
+
+		// The new Entities are attached at the end
+		world.createEntity().addComponent<Depth>(5);
+		world.update(0.f);
+		system.sort<Depth>(lessDepth, ecs::SortMode::Incremental);
+
+		depths.clear();
+
+		system.forEach([&](ecs::Entity const &entity)
+		{
+			depths.push_back(entity.getComponent<Depth>().value);
+		});
+
+		EXPECT(depths.size() == 21u);
+		EXPECT(std::is_sorted(depths.begin(), depths.end()));
+	},
+
+	CASE("The Entities without the Component go last")
+	{
+		ecs::World world;
+		auto &system{ world.addSystem<NameSystem>() };
+
+		auto first{ world.createEntity() };
+		first.addComponent<Name>("a");
+
+		auto second{ world.createEntity() };
+		second.addComponent<Name>("b");
+		second.addComponent<Depth>(2);
+
+		auto third{ world.createEntity() };
+		third.addComponent<Name>("c");
+		third.addComponent<Depth>(1);
+
+		world.update(0.f);
+		system.sort<Depth>(lessDepth);
+
+		auto const &entities{ system.getEntities() };
+
+		EXPECT(entities.size() == 3u);
+		EXPECT(entities[0].getId() == third.getId());
+		EXPECT(entities[1].getId() == second.getId());
+		EXPECT(entities[2].getId() == first.getId());
+	}
+};
+
+int main(int argc, char **argv)
+{
+	return lest::run(specification, argc, argv);
+}
@@ -0,0 +1,149 @@
+// Copyright (c) 2021 Ethan Margaillan <contact@ethan.jp>.
+// Licensed under the MIT License - https://raw.githubusercontent.com/Ethan13310/ECS/master/LICENSE
+
+#include <vector>
+
+#include <ECS.hpp>
+#include <lest/lest.hpp>
+
+struct Position : public ecs::Component
+{
+	Position(float x = 0.f) : x{ x } {}
+
+	float x;
+};
+
+struct Velocity : public ecs::Component
+{
+	Velocity(float x = 0.f) : x{ x } {}
+
+	float x;
+};
+
+struct Tag : public ecs::Component
+{};
+
+using World = ecs::StaticWorld<Velocity, Position, Tag>;
+
+static_assert(World::getComponentTypeId<Velocity>() == 0);
+static_assert(World::getComponentTypeId<Tag>() == 2);
+static_assert(World::getMask<Position, Tag>() == 0b110);
+
+lest::test const specification[] =
+{
+	CASE("Components are added, replaced and removed")
+	{
+		World world;
+
+		auto const id{ world.createEntity() };
+
+		world.addComponent<Position>(id, 1.f);
+		EXPECT(world.hasComponent<Position>(id));
+		EXPECT_NOT(world.hasComponent<Velocity>(id));
+		EXPECT(world.getComponentsMask(id) == World::getMask<Position>());
+
+		world.addComponent<Position>(id, 2.f);
+		EXPECT(world.getComponent<Position>(id).x == 2.f);
+		EXPECT(world.getPool<Position>().size() == 1u);
+
+		world.removeComponent<Position>(id);
+		EXPECT_NOT(world.hasComponent<Position>(id));
+		EXPECT_THROWS(world.getComponent<Position>(id));
+	},
+
+	CASE("Removing a Component keeps the other Components packed")
+	{
+		World world;
+
+		std::vector<ecs::Entity::Id> ids;
+
+		for (int i{ 0 }; i < 4; ++i)
+		{
+			ids.push_back(world.createEntity());
+			world.addComponent<Position>(ids.back(), static_cast<float>(i));
+		}
+
+		world.removeComponent<Position>(ids[1]);
+
+		EXPECT(world.getPool<Position>().size() == 3u);
+		EXPECT(world.getComponent<Position>(ids[0]).x == 0.f);
+		EXPECT(world.getComponent<Position>(ids[2]).x == 2.f);
+		EXPECT(world.getComponent<Position>(ids[3]).x == 3.f);
+	},
+
+	CASE("forEach visits the Entities which have all the Components")
+	{
+		World world;
+
+		for (int i{ 0 }; i < 10; ++i)
+		{
+			auto const id{ world.createEntity() };
+			world.addComponent<Position>(id, 0.f);
+
+			if (i % 2 == 0)
+			{
+				world.addComponent<Velocity>(id, static_cast<float>(i));
+			}
+		}
+
+		int count{ 0 };
+
+		world.forEach<Velocity, Position>([&](ecs::Entity::Id, Velocity &velocity, Position &position) {
+			position.x += velocity.x;
+			++count;
+		});
+
+		EXPECT(count == 5);
+
+		float sum{ 0.f };
+
+		world.forEach<Position>([&](ecs::Entity::Id, Position &position) {
+			sum += position.x;
+		});
+
+		EXPECT(sum == 20.f);
+	},
+
+	CASE("Removed Entities lose their Components and their IDs are reused")
+	{
+		World world;
+
+		auto const id{ world.createEntity() };
+		world.addComponent<Position>(id);
+		world.addComponent<Tag>(id);
+
+		world.removeEntity(id);
+
+		EXPECT_NOT(world.isEntityValid(id));
+		EXPECT(world.getEntityCount() == 0u);
+		EXPECT(world.getPool<Position>().size() == 0u);
+		EXPECT(world.getPool<Tag>().size() == 0u);
+		EXPECT_THROWS(world.removeEntity(id));
+		EXPECT_THROWS(world.addComponent<Position>(id));
+
+		auto const reused{ world.createEntity() };
+
+		EXPECT(reused == id);
+		EXPECT(world.getComponentsMask(reused) == 0u);
+		EXPECT_NOT(world.hasComponent<Position>(reused));
+	},
+
+	CASE("clear() removes all Entities")
+	{
+		World world;
+
+		auto const id{ world.createEntity() };
+		world.addComponent<Velocity>(id);
+
+		world.clear();
+
+		EXPECT_NOT(world.isEntityValid(id));
+		EXPECT(world.getEntityCount() == 0u);
+		EXPECT(world.getPool<Velocity>().size() == 0u);
+	}
+};
+
+int main(int argc, char **argv)
+{
+	return lest::run(specification, argc, argv);
+}
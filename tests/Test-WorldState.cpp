@@ -0,0 +1,240 @@
+// Copyright (c) 2021 Ethan Margaillan <contact@ethan.jp>.
+// Licensed under the MIT License - https://raw.githubusercontent.com/Ethan13310/ECS/master/LICENSE
+
+#include <memory>
+#include <optional>
+#include <stdexcept>
+#include <string>
+
+#include <ECS.hpp>
+#include <lest/lest.hpp>
+
+struct Position : public ecs::Component
+{
+	Position(float x = 0.f) : x{ x } {}
+
+	float x;
+};
+
+struct Name : public ecs::Component
+{
+	Name(std::string const &val = {}) : value{ val } {}
+
+	std::string value;
+};
+
+// Component whose copy can be made to fail
+struct Fragile : public ecs::Component
+{
+	Fragile() = default;
+
+	Fragile(Fragile const &)
+	{
+		if (failCopies)
+		{
+			throw std::runtime_error{ "Copy failed" };
+		}
+	}
+
+	static bool failCopies;
+};
+
+bool Fragile::failCopies{ false };
+
+class CountingSystem : public ecs::System
+{
+public:
+	CountingSystem()
+	{
+		getFilter().require<Position>();
+	}
+
+	void onEntityAttached(ecs::Entity) override
+	{
+		++events;
+	}
+
+	void onEntityDetached(ecs::Entity) override
+	{
+		++events;
+	}
+
+	void onEntityEnabled(ecs::Entity) override
+	{
+		++events;
+	}
+
+	void onEntityDisabled(ecs::Entity) override
+	{
+		++events;
+	}
+
+	int events{ 0 };
+};
+
+template <class T>
+void const *addressOf(T const& instance)
+{
+	return static_cast<void const*>(std::addressof(instance));
+}
+
+lest::test const specification[] =
+{
+	CASE("Save and restore a World")
+	{
+		ecs::World world;
+		ecs::WorldState state;
+
+		EXPECT(state.isEmpty());
+
+		auto entity{ world.createEntity("Entity") };
+		entity.addComponent<Position>(1.f);
+		entity.addComponent<Name>("Before");
+
+		world.update(0);
+		world.saveState(state);
+
+		EXPECT_NOT(state.isEmpty());
+
+		entity.getComponent<Position>().x = 2.f;
+		entity.getComponent<Name>().value = "After";
+		entity.removeComponent<Position>();
+
+		auto other{ world.createEntity("Other") };
+		other.addComponent<Position>(3.f);
+
+		world.update(0);
+		world.restoreState(state);
+
+		EXPECT(entity.isValid());
+		EXPECT_NOT(other.isValid());
+		EXPECT_NOT(world.getEntity("Other").has_value());
+
+		EXPECT(entity.getComponent<Position>().x == 1.f);
+		EXPECT(entity.getComponent<Name>().value == "Before");
+
+		// The IDs are given the same way
+		EXPECT(world.createEntity().getId() == other.getId());
+	},
+
+	CASE("Restore a World multiple times")
+	{
+		ecs::World world;
+		ecs::WorldState state;
+
+		auto entity{ world.createEntity() };
+		auto const address{ addressOf(entity.addComponent<Position>(1.f)) };
+
+		world.saveState(state);
+
+		for (int i{ 0 }; i < 8; ++i)
+		{
+			entity.getComponent<Position>().x += 1.f;
+			world.update(0);
+
+			world.restoreState(state);
+
+			EXPECT(entity.getComponent<Position>().x == 1.f);
+
+			// Components are restored in place
+			EXPECT(addressOf(entity.getComponent<Position>()) == address);
+		}
+	},
+
+	CASE("Restoring does not trigger System events")
+	{
+		ecs::World world;
+		auto &system{ world.addSystem<CountingSystem>() };
+
+		auto entity{ world.createEntity() };
+		entity.addComponent<Position>();
+
+		world.update(0);
+
+		EXPECT(system.getEntityCount() == 1);
+
+		ecs::WorldState state;
+		world.saveState(state);
+
+		entity.remove();
+		world.update(0);
+
+		EXPECT(system.getEntityCount() == 0);
+
+		auto const events{ system.events };
+		world.restoreState(state);
+
+		EXPECT(system.events == events);
+		EXPECT(system.getEntityCount() == 1);
+		EXPECT(system.getEntities()[0] == entity);
+	},
+
+	CASE("Restore a state into another World")
+	{
+		ecs::World world;
+		ecs::World other;
+		ecs::WorldState state;
+
+		EXPECT_THROWS(world.restoreState(state));
+
+		world.saveState(state);
+
+		EXPECT_NO_THROW(world.restoreState(state));
+		EXPECT_THROWS(other.restoreState(state));
+	},
+
+	CASE("A state is not restored into a new World at the same address")
+	{
+		std::optional<ecs::World> world;
+		ecs::WorldState state;
+
+		world.emplace();
+		world->createEntity();
+		world->saveState(state);
+
+		world.reset();
+		world.emplace();
+
+		EXPECT_THROWS(world->restoreState(state));
+		EXPECT_NOT(world->isEntityValid(0));
+	},
+
+	CASE("A failed restore leaves an empty World")
+	{
+		ecs::World world;
+		ecs::WorldState state;
+
+		world.addSystem<CountingSystem>();
+
+		for (int i{ 0 }; i < 4; ++i)
+		{
+			auto entity{ world.createEntity() };
+			entity.addComponent<Position>();
+			entity.addComponent<Fragile>();
+		}
+
+		world.update(0);
+		world.saveState(state);
+
+		Fragile::failCopies = true;
+		EXPECT_THROWS(world.restoreState(state));
+		Fragile::failCopies = false;
+
+		EXPECT_NOT(world.isEntityValid(0));
+		EXPECT(world.getSystem<CountingSystem>().getEntityCount() == 0u);
+
+		// The World is still usable
+		world.createEntity().addComponent<Position>();
+		world.update(0);
+		EXPECT(world.getSystem<CountingSystem>().getEntityCount() == 1u);
+
+		world.restoreState(state);
+		EXPECT(world.isEntityValid(3));
+		EXPECT(world.getSystem<CountingSystem>().getEntityCount() == 4u);
+	}
+};
+
+int main(int argc, char **argv)
+{
+	return lest::run(specification, argc, argv);
+}